@@ -0,0 +1,53 @@
+#version 430 core
+
+// [߰]   GPU ø -  ϳ  ϳ
+// ü(: , ̴ϸ:  ڽ) ȿ ִ   ׸  տ ä
+layout(local_size_x = 64) in;
+
+struct CullObject {
+    vec4 boundsMin; // xyz:  AABB ּ, w: 1̸ ̴ϸʿ  (isObstacle)
+    vec4 boundsMax; // xyz:  AABB ִ, w: ̴   ȣ
+    uvec4 draw;     // x:  , y:    , z: ڵ ȣ, w:    ġ
+};
+
+layout(std430, binding = 2) readonly buffer CullInput {
+    CullObject objects[];
+};
+
+// DrawArraysIndirectCommand { count, instanceCount, first, baseInstance }
+layout(std430, binding = 3) writeonly buffer CullCommands {
+    uvec4 commands[];
+};
+
+// н x  x: Ƴ   (glMultiDrawArraysIndirectCount ), y:   ()
+const uint CULL_GROUPS = 4u;
+layout(std430, binding = 4) buffer CullCounters {
+    uvec2 counters[];
+};
+
+uniform vec4 frustumPlanes[6];
+uniform uint objectCount;
+uniform uint passIndex;     // 0: , 1: ̴ϸ
+uniform uint commandBase;   //  н   ġ
+uniform int skipObstacles;  // ̴ϸ   
+
+void main() {
+    uint i = gl_GlobalInvocationID.x;
+    if (i >= objectCount) return;
+
+    CullObject o = objects[i];
+    if (skipObstacles == 1 && o.boundsMin.w > 0.5) return;
+
+    // AABB  ϳ  ٱ̸ 
+    vec3 center = (o.boundsMin.xyz + o.boundsMax.xyz) * 0.5;
+    vec3 extent = (o.boundsMax.xyz - o.boundsMin.xyz) * 0.5;
+    for (int p = 0; p < 6; ++p) {
+        vec4 plane = frustumPlanes[p];
+        if (dot(plane.xyz, center) + plane.w + dot(extent, abs(plane.xyz)) < 0.0) return;
+    }
+
+    uint counter = passIndex * CULL_GROUPS + uint(o.boundsMax.w);
+    uint slot = atomicAdd(counters[counter].x, 1u);
+    atomicAdd(counters[counter].y, o.draw.x);
+    commands[commandBase + o.draw.w + slot] = uvec4(o.draw.x, 1u, o.draw.y, o.draw.z);
+}
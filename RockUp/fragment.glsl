@@ -4,23 +4,27 @@ in vec3 vertexColor;
 in vec3 FragPos;
 in vec3 Normal;
 in vec2 TexCoord; // [߰]
+in float Layer;   // [߰] ؽó 迭 ̾
+flat in vec3 ObjectColor;  // []   (  ڵ,  ̴ )
 
 out vec4 FragColor;
 
 uniform vec3 lightPos;
 uniform vec3 lightColor;
 uniform vec3 viewPos;
-uniform vec3 objectColor;
 
-uniform sampler2D texture1; // [߰] ؽó ÷
-uniform int useTexture;     // [߰] ؽó   (1: , 0: ̻)
+uniform sampler2DArray texture1; // [] ؽó 迭 ÷
 
 void main() {
     // 0. ؽó ó
-    vec3 finalObjectColor = objectColor;
-    if (useTexture == 1) {
-        finalObjectColor = texture(texture1, TexCoord).rgb;
-    }
+    // [] б  ̴  (C++ TEXTURED / VERTEX_COLOR  )
+#if defined(TEXTURED)
+    vec3 finalObjectColor = texture(texture1, vec3(TexCoord, Layer)).rgb;
+#elif defined(VERTEX_COLOR)
+    vec3 finalObjectColor = vertexColor; //  ۴  
+#else
+    vec3 finalObjectColor = ObjectColor;
+#endif
 
     // 1. ֺ (Ambient)
     vec3 ambientLight = vec3(0.5);
@@ -1,21 +1,55 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
 #include <iostream>
 #include <vector>
 #include <string>
 #include <time.h> 
 #include <algorithm>
 #include <cmath> 
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <new>
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h" // stb_image ̺귯 ʿ
 
 #pragma comment(lib, "glew32.lib")
 #pragma comment (lib, "freeglut.lib")
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX // std::min/max  浹 
+#endif
+#include <windows.h>
+#include <mmsystem.h>
+#include <psapi.h>
+#pragma comment (lib, "winmm.lib") // timeBeginPeriod (Sleep е 1ms)
+#pragma comment (lib, "psapi.lib") // GetProcessMemoryInfo (--bench ޸ Ʈ)
+#else
+#include <unistd.h> // sysconf (--bench ޸ Ʈ)
+#endif
+
 #include <gl/glew.h>
 #include <gl/freeglut.h>
 #include <gl/freeglut_ext.h>
+#ifdef _WIN32
+#include <gl/wglew.h> // wglSwapIntervalEXT ( )
+#else
+#include <gl/glxew.h> // [߰] glXSwapIntervalEXT / MESA ( )
+#include <EGL/egl.h>  // --bench 帮 ؽƮ
+#include <EGL/eglext.h>
+#endif
 #include <gl/glm/glm.hpp>
 #include <gl/glm/ext.hpp>
 #include <gl/glm/gtc/matrix_transform.hpp>
@@ -36,11 +70,38 @@ enum GameState {
 GameState currentState = LOBBY;
 
 // --- ü  ---
+const int MAX_SHAPE_LODS = 4; // [߰]  ϳ   ִ LOD ܰ 
+
+// []  GL ۸   -  GL 尡   (SceneGeometry) ø
+// (ùķ̼ 忡    ֵ)
+// [߰] ޽ Ʒ(  ) ö   - Ʒ "޽ Ʒ" 
+// []    ( Ҵ /  ) -  ȯ   (   °)
+struct Mesh {
+    int first = -1, vertexCount = 0;    // Ʒ    (׸ ڵ, first < 0̸   )
+    glm::vec3 boundsMin, boundsMax;     //  AABB (  ø Է)
+};
+
+struct MeshRange { int first, count, freedVersion; };
+struct MeshUpload { int first; std::vector<float> vertices; };
+
+struct MeshArena {
+    bool gpu = false;                   // GL ؽƮ   ε ⿭ ä (--bench-sim ٷ )
+    int top = 0;                        // ݱ    (Ʒ )
+    int publishedVersion = 0;           //   SceneGeometrySet  (ùķ̼ )
+    std::vector<MeshRange> freeRanges;  // ȯ  (ùķ̼ )
+    std::vector<MeshRange> runRanges;   // [߰] ̹      (   ϳ, ReleaseRunData Ѳ ȯ)
+    std::atomic<int> drawnVersion{ 0 }; // GL 尡 ׸  SceneGeometrySet 
+    std::atomic<int> liveVertices{ 0 }; // 
+    std::mutex uploadMutex;
+    std::vector<MeshUpload> uploads;    // (uploadMutex) GL 尡  ӿ ø 
+};
+MeshArena meshArena;
+
 struct Shape {
-    GLuint VAO, VBO, CBO, NBO, TBO; // [] TBO (Texture Buffer) ߰
     GLenum primitiveType;
     int vertexCount;
     float color[3];
+    // []  ʹ  ȸ - ޽ Ʒ ϸ  mesh ڵ鸸 
     std::vector<float> vertices;
     std::vector<float> normals;
     std::vector<float> colors;
@@ -57,7 +118,19 @@ struct Shape {
     bool isObstacle = false;
     bool isWall = false; //   ĺ ÷
 
-    GLuint specificTextureID = 0;
+    int textureLayer = -1; // []  ؽó() 迭 ̾ (-1: )
+    bool hasVertexLayers = false; // [߰] ̾ ȣ  Ӽ  (ؽó  )
+
+    bool isStaticBatch = false; // [߰]     (  )
+    std::vector<float> layers;  // [߰]  ؽó ̾ (hasVertexLayers )
+
+    // [߰] LOD -  ܰ踦  ۿ ̾ ̰ ׸    (0:  )
+    int lodLevels = 0;                       // 0̸ LOD  (vertexCount ü ׸)
+    int lodFirst[MAX_SHAPE_LODS];            // ܰ躰  
+    int lodVertexCount[MAX_SHAPE_LODS];      // ܰ躰  
+    float lodRadius = 0.0f;                  // ȭ ũ    
+
+    Mesh mesh; // []      (ص   )
 };
 
 struct Player {
@@ -89,16 +162,210 @@ struct Player {
     }
 };
 
+// ---  Ʒ ---
+// [߰]  (  ~ /Ŭ) ȸ   -   , 浹ü,   ӽ 迭
+// ûũ θ ߶ ְ    ,   Reset   ǵ (ûũ  ǿ )
+// Ͱ Ʒ ȿ Ŀ  ۴    Ƿ GenerateMap ʿ ũ⸦  reserve
+const size_t RUN_ARENA_CHUNK = 256 * 1024;
+
+struct RunArena {
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+    std::vector<Chunk> chunks;
+    size_t current = 0, offset = 0; //  ڸ ûũ /   ġ
+    size_t used = 0, peak = 0;      //  (̹  / ִ)
+
+    void* Allocate(size_t bytes, size_t align) {
+        for (;;) {
+            if (current < chunks.size()) {
+                size_t start = (offset + align - 1) & ~(align - 1);
+                if (start + bytes <= chunks[current].size) {
+                    offset = start + bytes;
+                    used += bytes;
+                    peak = std::max(peak, used);
+                    return chunks[current].data.get() + start;
+                }
+                if (current + 1 < chunks.size()) { ++current; offset = 0; continue; }
+            }
+            size_t size = std::max(RUN_ARENA_CHUNK, bytes + align);
+            chunks.push_back({ std::unique_ptr<char[]>(new char[size]), size });
+            current = chunks.size() - 1;
+            offset = 0;
+        }
+    }
+    // O(1) - ûũ ״ ΰ ó ٽ ڸ
+    void Reset() { current = 0; offset = 0; used = 0; }
+};
+
+// ǥ ̳ʿ - arena NULL̸ Ϲ  (÷̾ / κó ǰ  )
+template <typename T>
+struct RunAllocator {
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+    RunArena* arena;
+
+    RunAllocator(RunArena* a = NULL) : arena(a) {}
+    template <typename U> RunAllocator(const RunAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        if (!arena) return static_cast<T*>(::operator new(n * sizeof(T)));
+        return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* p, size_t) {
+        if (!arena) ::operator delete(p);
+    }
+};
+template <typename T, typename U> bool operator==(const RunAllocator<T>& a, const RunAllocator<U>& b) { return a.arena == b.arena; }
+template <typename T, typename U> bool operator!=(const RunAllocator<T>& a, const RunAllocator<U>& b) { return a.arena != b.arena; }
+
+template <typename T> using RunVector = std::vector<T, RunAllocator<T>>;
+
+// ---   ---
+// [߰]  ȣ  ڵ Ҹ Ű 
+//  ó  迭 (ȣ ȸ / ParallelFor ״), ڵ ->  -> 迭 ġ    ħ
+// 迭 Ҵǰų  Ұ  ġ ٲ ڵ ״,   ڵ Get NULL
+// ( /   ߰ /   -  ų  ڵ )
+const uint32_t SLOT_NONE = 0xFFFFFFFFu;
+
+struct SlotHandle {
+    uint32_t slot = SLOT_NONE;
+    uint32_t generation = 0;
+};
+
+template <typename T, typename Alloc = std::allocator<T>>
+struct SlotMap {
+    struct Slot {
+        uint32_t dense;      //  ġ ( ̸   )
+        uint32_t generation; //   +1 -  ڵ  ʰ
+    };
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<uint32_t> IndexAlloc;
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Slot> SlotAlloc;
+
+    std::vector<T, Alloc> values;
+    std::vector<uint32_t, IndexAlloc> owners; // values[i]  ȣ
+    std::vector<Slot, SlotAlloc> slots;
+    uint32_t freeHead = SLOT_NONE;
+    uint32_t nextGeneration = 0; //   ù  - Reset ڿ  ڵ麸 ũ
+
+    SlotMap(const Alloc& alloc = Alloc()) : values(alloc), owners(IndexAlloc(alloc)), slots(SlotAlloc(alloc)) {}
+
+    size_t size() const { return values.size(); }
+    bool empty() const { return values.empty(); }
+    typename std::vector<T, Alloc>::iterator begin() { return values.begin(); }
+    typename std::vector<T, Alloc>::iterator end() { return values.end(); }
+    typename std::vector<T, Alloc>::const_iterator begin() const { return values.begin(); }
+    typename std::vector<T, Alloc>::const_iterator end() const { return values.end(); }
+    T& operator[](size_t i) { return values[i]; }
+    const T& operator[](size_t i) const { return values[i]; }
+    // []  ִ ڵ鸸 -  /  ڵ̸ assert (Ȯ ʿϸ Get)
+    T& operator[](SlotHandle h) {
+        T* value = Get(h);
+        assert(value && "stale or empty SlotHandle");
+        return *value;
+    }
+
+    void reserve(size_t n) { values.reserve(n); owners.reserve(n); slots.reserve(n); }
+
+    //  迭  ٷ  (ڸ ״ ڿ -  )
+    template <typename... Args>
+    SlotHandle Emplace(Args&&... args) {
+        values.emplace_back(std::forward<Args>(args)...);
+        uint32_t slot = AcquireSlot((uint32_t)values.size() - 1);
+        owners.push_back(slot);
+        SlotHandle h;
+        h.slot = slot;
+        h.generation = slots[slot].generation;
+        return h;
+    }
+
+    // ⺻ count ߰  ù ġ ȯ (۾ 尡 ȣ  ä )
+    size_t Extend(size_t count) {
+        size_t first = values.size();
+        values.resize(first + count);
+        for (size_t i = first; i < values.size(); ++i) owners.push_back(AcquireSlot((uint32_t)i));
+        return first;
+    }
+
+    T* Get(SlotHandle h) {
+        if (h.slot >= slots.size() || slots[h.slot].generation != h.generation) return NULL;
+        return &values[slots[h.slot].dense];
+    }
+
+    SlotHandle HandleAt(size_t i) const {
+        SlotHandle h;
+        h.slot = owners[i];
+        h.generation = slots[h.slot].generation;
+        return h;
+    }
+
+    // pred        (׸  ) -   ڵ ״
+    template <typename Pred>
+    void RemoveIf(Pred pred) {
+        size_t w = 0;
+        for (size_t r = 0; r < values.size(); ++r) {
+            if (pred(values[r])) { ReleaseSlot(owners[r]); continue; }
+            if (w != r) {
+                values[w] = std::move(values[r]);
+                owners[w] = owners[r];
+                slots[owners[w]].dense = (uint32_t)w;
+            }
+            ++w;
+        }
+        values.erase(values.begin() + w, values.end());
+        owners.resize(w);
+    }
+
+    void clear() {
+        for (uint32_t slot : owners) ReleaseSlot(slot);
+        values.clear();
+        owners.clear();
+    }
+
+    // ޸°  ( Ʒ ǵ ) -   ݱ   뺸 ũ 
+    void Reset(const Alloc& alloc) {
+        std::vector<T, Alloc>(alloc).swap(values);
+        std::vector<uint32_t, IndexAlloc>(IndexAlloc(alloc)).swap(owners);
+        std::vector<Slot, SlotAlloc>(SlotAlloc(alloc)).swap(slots);
+        freeHead = SLOT_NONE;
+        nextGeneration++;
+    }
+
+    uint32_t AcquireSlot(uint32_t dense) {
+        if (freeHead != SLOT_NONE) {
+            uint32_t slot = freeHead;
+            freeHead = slots[slot].dense;
+            slots[slot].dense = dense;
+            return slot;
+        }
+        Slot s = { dense, nextGeneration };
+        slots.push_back(s);
+        return (uint32_t)slots.size() - 1;
+    }
+    void ReleaseSlot(uint32_t slot) {
+        Slot& s = slots[slot];
+        s.generation++;
+        nextGeneration = std::max(nextGeneration, s.generation + 1);
+        s.dense = freeHead;
+        freeHead = slot;
+    }
+};
+
+typedef SlotMap<Shape, RunAllocator<Shape>> ShapeList;
+typedef SlotHandle ShapeHandle;
+typedef RunVector<std::pair<glm::vec3, glm::vec3>> BlockList;
+
 // ---   ---
 GLint g_width = 1200, g_height = 1200;
-GLuint shaderProgramID;
-GLuint vertexShader, fragmentShader;
 
-std::vector<Shape> shapes;         // ÷̾
-std::vector<Shape> lobbyShapes;    // κ + ͳ
-std::vector<Shape> mapShapes;      //  
+RunArena runArena;                 // [߰]   ( Ϻ   - ߿ Ҹ)
+ShapeList shapes;                  // ÷̾
+ShapeList lobbyShapes;             // κ + ͳ
+ShapeList mapShapes{ RunAllocator<Shape>(&runArena) }; //  
 
-std::vector<std::pair<glm::vec3, glm::vec3>> mapBlocks;
+BlockList mapBlocks{ BlockList::allocator_type(&runArena) };
 std::vector<std::pair<glm::vec3, glm::vec3>> lobbyBlocks;
 
 // ī޶  
@@ -118,321 +385,2626 @@ float mouseSensitivity = 0.3f;
 int camera_mode = 2;
 
 Player rock;
-int playerShapeIndex = -1;
+ShapeHandle playerShape; // [] ȣ  ڵ
 bool keyState[256] = { false };
 bool isDoorOpen = false; // ٴ  
 
 // Ÿ̸  
 float gameTime = 0.0f;     //  ÷ ð ()
-int startTime = 0;         //    (ms)
+long long startTick = 0;   //    ( ƽ)
 bool isTimerRunning = false; // Ÿ̸ ۵ 
 char timeBuffer[50];       // ð ؽƮ  ڿ
 
-//  
-const int MAP_WIDTH = 80;
-const int MAP_HEIGHT = 150;
-const int MAP_DEPTH = 80;
+// ƽ  Է ̺Ʈ (Ű ݹ鿡 Ҵٰ  ƽ ۿ )
+enum InputEventFlag {
+    INPUT_JUMP = 1,
+    INPUT_RESET = 2,
+    INPUT_TELEPORT = 4,
+    INPUT_CAMERA = 0x80 //   :  ƽ yaw/pitch ڵ
+};
+unsigned char pendingEvents = 0;
+long long simTick = 0;     // ݱ   ƽ 
+
+// [߰] GLUT ݹ -> ùķ̼  Է ť ( ϳ, Һ ϳ -  )
+// ݹ keyState / ī޶   ٲ ʰ ̺Ʈ  ->  ƽ ۿ ùķ̼ ʿ 
+enum InputEventType {
+    INPUT_EVENT_KEY_DOWN,
+    INPUT_EVENT_KEY_UP,
+    INPUT_EVENT_LOOK     // 콺 巡 (yaw/pitch ȭ)
+};
+struct InputEvent {
+    InputEventType type;
+    unsigned char key;
+    float dyaw, dpitch;
+    bool clampPitch;     // ī޶  2 - pitch  
+};
+const int INPUT_QUEUE_SIZE = 256; // 2 ŵ
+
+struct InputQueue {
+    InputEvent events[INPUT_QUEUE_SIZE];
+    std::atomic<unsigned> head{ 0 }, tail{ 0 }; // head: Һ, tail: 
+
+    //    ( ƽ ̿ 256   )
+    bool Push(const InputEvent& e) {
+        unsigned t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) >= (unsigned)INPUT_QUEUE_SIZE) return false;
+        events[t % INPUT_QUEUE_SIZE] = e;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+    bool Pop(InputEvent& e) {
+        unsigned h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        e = events[h % INPUT_QUEUE_SIZE];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+};
+InputQueue inputQueue;
+
+// [߰]  ùķ̼  (--no-sim-thread FrameIdle ƽ)
+struct SimulationThread {
+    bool threaded = true;
+    std::thread worker;
+    std::atomic<bool> quit{ false };
+    std::atomic<long long> ticks{ 0 };      //  - EndFrame   0
+    std::atomic<long long> lateTicks{ 0 };  //  ð ʰ  ƽ ( ƽ )
+};
+SimulationThread simThread;
+bool sceneShapesDirty = true; // [߰]  ߰// ->    SceneGeometrySet  
+
+//  ٷ
+enum FrameMode {
+    FRAME_UNCAPPED, //  
+    FRAME_VSYNC,    // 
+    FRAME_CAPPED    // targetHz  (Sleep + )
+};
+typedef std::chrono::steady_clock FrameClock;
+
+struct FrameScheduler {
+    FrameMode mode = FRAME_CAPPED;
+    double targetHz = 60.0;
+    FrameClock::time_point nextFrame;   //    ð
+    FrameClock::time_point lastTick;
+    double tickAccumulator = 0.0;
+    bool redrawRequested = true;        //  ӿ ׸ ʿ䰡  (  ûص  )
+    long long drawnSnapshot = 0;        // [߰]  ׸⸦ û  ȣ (ùķ̼ )
+    bool interpolate = true;            // [߰] ƽ ̸   н ׸ (--no-interpolate / --bench )
+
+    // 
+    FrameClock::time_point lastFrame, reportTime;
+    int frameCount = 0;
+    double frameTimeSum = 0.0, frameTimeMax = 0.0;
+    int missedDeadlines = 0;
+};
+FrameScheduler frameScheduler;
+const double PHYSICS_TICK_SEC = 0.016; //   ƽ ( Ÿ̸ 16ms)
+const float INTERP_MAX_STEP = 10.0f;   // [߰]  ƽ ̺ ָ ̸ ̵ -  
+const int FRAME_MAX_TICKS = 5;         //    ִ ƽ 
+const double FRAME_SPIN_MS = 2.0;      //   ٻ  
+
+void SetFrameMode(FrameMode mode);
+void EndFrame();
+
+// α׷    ð (ms) - GLUT â (--bench) ϵ steady_clock 
+const FrameClock::time_point programStartTime = FrameClock::now();
+int GetElapsedMs() {
+    return (int)std::chrono::duration_cast<std::chrono::milliseconds>(FrameClock::now() - programStartTime).count();
+}
+
+// [߰] μ  ޸ (Ʈ) - --bench Ʈ,    0
+size_t ResidentMemoryBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    return pmc.WorkingSetSize;
+#else
+    FILE* f = fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    long pages = 0, resident = 0;
+    if (fscanf(f, "%ld %ld", &pages, &resident) != 2) resident = 0;
+    fclose(f);
+    return (size_t)resident * sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// Ӵ ׸  (--bench Ʈ)
+struct RenderStats {
+    int drawCalls = 0;
+    long long triangles = 0;
+};
+RenderStats renderStats;
+
+// [߰] LOD  - ȭ鿡  (px) ܰ踦 
+const int SPHERE_LOD_COUNT = 4;
+const int SPHERE_LOD_DIVISIONS[SPHERE_LOD_COUNT] = { 30, 16, 10, 6 }; //    (浵 = )
+const float LOD_SCREEN_RADIUS[MAX_SHAPE_LODS - 1] = { 48.0f, 20.0f, 8.0f }; // ܰ i i+1  (px)
+const float LOD_HYSTERESIS = 0.15f; //  +-15% ȿ ܰ踦 ٲ  ( )
+
+//  ķ ߽ center,  radius  ȭ (px)  (/ )
+float ProjectedRadius(const glm::mat4& viewProj, const glm::mat4& proj, glm::vec3 center, float radius, int viewportH) {
+    glm::vec4 clip = viewProj * glm::vec4(center, 1.0f);
+    float w = std::max(clip.w, 0.001f);
+    return radius * proj[1][1] / w * viewportH * 0.5f;
+}
+
+//  ܰ迡 踦  Ѿ 쿡  ܰ辿 ̵
+// []  ܰ(current)  غ 尡  (  ùķ̼  )
+int SelectLod(int lodLevels, int& current, float screenRadius) {
+    int lod = std::min(current, lodLevels - 1);
+    while (lod < lodLevels - 1 && screenRadius < LOD_SCREEN_RADIUS[lod] * (1.0f - LOD_HYSTERESIS)) lod++;
+    while (lod > 0 && screenRadius > LOD_SCREEN_RADIUS[lod - 1] * (1.0f + LOD_HYSTERESIS)) lod--;
+    current = lod;
+    return lod;
+}
+
+//   []    (--map-config) / (--map-set key=value)  
+struct MapConfig {
+    int width = 80;             //  ̴ X  (ٴ )
+    int depth = 80;             //  ̴ Z  (ٴ )
+    int layers = 150;           //  
+    int layerStep = 2;          //    
+    float layerSpacing = 3.0f;  //   
+    int platformsMin = 1;       //    (յ )
+    int platformsMax = 2;
+    float sizeMin = 4.0f;       //  ũ X/Z (0.1  յ )
+    float sizeMax = 6.9f;
+};
+MapConfig mapConfig;
 
 //   õ尪
 unsigned int mapSeed = 327;
 
-GLuint rockTextureID; // ؽó ID 
-GLuint wallTextureID; // [߰]  ؽó ID
+//  ǥ(Goal)  -     
+float GoalHeight() {
+    return mapConfig.layers * mapConfig.layerSpacing + 5.0f;
+}
+
+// [߰] "key=value"  ׸ mapConfig ݿ (𸣴 Ű/߸ ̸ false)
+bool SetMapConfigValue(const char* key, const char* value) {
+    MapConfig c = mapConfig;
+    if (strcmp(key, "width") == 0) c.width = atoi(value);
+    else if (strcmp(key, "depth") == 0) c.depth = atoi(value);
+    else if (strcmp(key, "layers") == 0) c.layers = atoi(value);
+    else if (strcmp(key, "layer_step") == 0) c.layerStep = atoi(value);
+    else if (strcmp(key, "layer_spacing") == 0) c.layerSpacing = (float)atof(value);
+    else if (strcmp(key, "platforms_min") == 0) c.platformsMin = atoi(value);
+    else if (strcmp(key, "platforms_max") == 0) c.platformsMax = atoi(value);
+    else if (strcmp(key, "size_min") == 0) c.sizeMin = (float)atof(value);
+    else if (strcmp(key, "size_max") == 0) c.sizeMax = (float)atof(value);
+    else if (strcmp(key, "seed") == 0) { mapSeed = (unsigned int)strtoul(value, NULL, 10); return true; }
+    else {
+        printf("[MapConfig] Unknown key: %s\n", key);
+        return false;
+    }
+
+    //  ٴ   ʵ ּҰ  (range = width/2 - 5)
+    if (c.width < 12 || c.depth < 12 || c.layers < 1 || c.layerStep < 1 || c.layerSpacing <= 0.0f ||
+        c.platformsMin < 0 || c.platformsMax < c.platformsMin || c.sizeMin <= 0.0f || c.sizeMax < c.sizeMin) {
+        printf("[MapConfig] Invalid value: %s=%s\n", key, value);
+        return false;
+    }
+    mapConfig = c;
+    return true;
+}
+
+// [߰]   б -  ٿ key=value, '#' ڴ ּ
+bool LoadMapConfig(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        printf("[MapConfig] Cannot open file: %s\n", path);
+        return false;
+    }
+    char line[256];
+    bool ok = true;
+    while (fgets(line, sizeof(line), f)) {
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        char key[64], value[64];
+        if (sscanf(line, " %63[^= \t] = %63s", key, value) == 2)
+            ok = SetMapConfigValue(key, value) && ok;
+    }
+    fclose(f);
+    return ok;
+}
+
+// [߰]  --map-config / --map-set ó (ġ/ )
+bool ParseMapArgs(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--map-config") == 0 && i + 1 < argc) {
+            if (!LoadMapConfig(argv[++i])) return false;
+        }
+        else if (strcmp(argv[i], "--map-set") == 0 && i + 1 < argc) {
+            char key[64], value[64];
+            if (sscanf(argv[++i], "%63[^=]=%63s", key, value) != 2 || !SetMapConfigValue(key, value)) return false;
+        }
+    }
+    const MapConfig& c = mapConfig;
+    printf("[MapConfig] %dx%d, %d layers (spacing %.1f, every %d), platforms per layer %d-%d, size %.1f-%.1f\n",
+        c.width, c.depth, c.layers, c.layerSpacing, c.layerStep, c.platformsMin, c.platformsMax, c.sizeMin, c.sizeMax);
+    return true;
+}
+
+int rockTextureLayer = -1; // ؽó 迭 ̾ ȣ 
+int wallTextureLayer = -1; // [߰]  ؽó ̾
 
-GLuint texCtrl1, texCtrl2, texCtrl3, texCtrl4;
+int texCtrl1 = -1, texCtrl2 = -1, texCtrl3 = -1, texCtrl4 = -1;
 
 // --- Լ  ---
-void make_vertexShaders();
-void make_fragmentShaders();
-GLuint make_shaderProgram();
-void setupShapeBuffers(Shape& shape, const std::vector<float>& vertices, const std::vector<float>& colors, const std::vector<float>& normals);
+// [] ̴ α׷ 񵿱  - ũ  onReady(α׷,  ) ȣ
+typedef std::function<void(GLuint program, bool ok)> ProgramReadyFn;
+GLuint make_shaderProgram(int features, ProgramReadyFn onReady);
+void PollProgramBuilds();
+void WaitProgramBuilds();
+void FailRequiredProgram(const char* name);
+bool parallelShaderCompile = false; // [߰] GL_KHR_parallel_shader_compile  
 GLvoid drawScene();
 GLvoid Reshape(int w, int h);
 GLvoid Keyboard(unsigned char key, int x, int y);
 GLvoid KeyboardUp(unsigned char key, int x, int y);
 void Mouse(int button, int state, int x, int y);
 void Motion(int x, int y);
-void TimerFunction(int value);
+void FrameIdle();
+void RequestRedraw();
 char* filetobuf(const char* file);
-Shape* ShapeSave(std::vector<Shape>& shapeVector, char shapeKey, float r, float g, float b, float sx, float sy, float sz);
+ShapeHandle ShapeSave(ShapeList& shapeVector, char shapeKey, float r, float g, float b, float sx, float sy, float sz);
+ShapeHandle ShapeSave(ShapeList& shapeVector, Shape&& shape);
+Shape MakeShape(char shapeKey, float r, float g, float b, float sx, float sy, float sz);
 void GenerateMap();
 void GenerateLobby();
+void BuildStaticBatch(ShapeList& list);
 void UpdatePhysics();
 void ResetGame();
+void ReleaseRunData();
+void UpdateFollowCamera();
+void SimulationTick();
+float RunSimulationStep();
+void StartSimulationThread();
+void TeleportToGoal();
+void Jump();
+bool StartInputRecord(const char* path);
+int RunReplay(const char* path);
+int RunSimBenchmark(int argc, char** argv);
+bool CheckCollision(glm::vec3 spherePos, float radius, glm::vec3 boxPos, glm::vec3 boxSize);
+void RenderFrame();
+int RunBenchmark(int argc, char** argv);
+
+// --- ۾ ٷ (work stealing) ---
+// [߰] ؽó ڵ,  ,   Ⱑ  带  ʰ  ۾  Ǯ ۾ 
+// 帶 ڱ : ڱ ۾ ڿ (LIFO - ĳÿ  ִ ͺ),   ٸ  տ  
+// ۾ 尡 ƴ (GL / ùķ̼ /  غ )  ۾ ܺ (0)
+// JobCounter:  ۾  - ٸ  0    ī ۾    ( )
+// : SubmitJob(..., after) after 0  ڿ  
+//   RockUp --jobs N (۾  , ⺻: ھ  - 1)
+struct JobCounter;
+
+struct Job {
+    std::function<void()> fn;
+    JobCounter* counter;      //  1  (NULL )
+};
 
-unsigned int loadTexture(const char* path) {
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-
-    int width, height, nrComponents;
-    unsigned char* data = stbi_load(path, &width, &height, &nrComponents, 0);
-    if (data) {
-        GLenum format;
-        if (nrComponents == 1) format = GL_RED;
-        else if (nrComponents == 3) format = GL_RGB;
-        else if (nrComponents == 4) format = GL_RGBA;
+struct JobCounter {
+    std::atomic<int> pending{ 0 };
+    std::mutex mutex;               // continuations /  
+    std::vector<Job> continuations; //  īͰ 0 Ǹ  ۾
+};
 
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+struct JobQueue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+};
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+void FinishJob(JobCounter* counter);
+
+struct JobSystem {
+    std::vector<std::unique_ptr<JobQueue>> queues; // 0: ܺ, 1~: ۾ 
+    std::vector<std::thread> workers;
+    std::atomic<int> queued{ 0 };     //   ִ ۾  ( Ǵ)
+    std::atomic<unsigned> nextSteal{ 0 };
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool quit = false;                // (sleepMutex)
+    int requestedWorkers = -1;        // --jobs (-1̸ ھ  - 1)
+};
+JobSystem jobSystem;
+thread_local int jobQueueIndex = 0; // ۾  ڱ  ȣ
 
-        stbi_image_free(data);
-        printf("Texture loaded: %s\n", path);
-    }
-    else {
-        printf("Texture failed to load at path: %s\n", path);
-        stbi_image_free(data);
+void PushJob(Job job) {
+    // [] ۾ 尡  ( , --jobs 0) ٷ  - ־  ۾  尡 
+    if (jobSystem.workers.empty()) { job.fn(); FinishJob(job.counter); return; }
+    JobQueue& q = *jobSystem.queues[jobQueueIndex];
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.jobs.push_back(std::move(job));
     }
-    return textureID;
+    jobSystem.queued++;
+    std::lock_guard<std::mutex> lock(jobSystem.sleepMutex);
+    jobSystem.wake.notify_one();
 }
 
-// ؽƮ  Լ
-void RenderText(float x, float y, const char* text, float r, float g, float b, float scale) {
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_LIGHTING);
-
-    glMatrixMode(GL_PROJECTION);
-    glPushMatrix();
-    glLoadIdentity();
-    gluOrtho2D(0, g_width, 0, g_height);
-
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity();
-
-    glTranslatef(x, y, 0.0f);
-    glScalef(scale, scale, 1.0f);
-
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glEnable(GL_LINE_SMOOTH);
-    glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
-
-    glLineWidth(2.0f); // β 1.5f ~ 2.5f ̷ غ
-    glColor3f(r, g, b);
-
-    for (const char* c = text; *c != '\0'; c++) {
-        glutStrokeCharacter(GLUT_STROKE_ROMAN, *c);
+// ڱ   -> ٸ    ϳ 
+// [] only   ī ۾ - ٸ (ùķ̼ ƽ ) ؽó ڵ   ۾  ʰ
+bool TakeJob(Job& job, JobCounter* only = NULL) {
+    if (jobSystem.queued == 0) return false;
+    int n = (int)jobSystem.queues.size();
+    int start = jobSystem.nextSteal++ % n;
+    for (int k = -1; k < n; ++k) {
+        int idx = (k < 0) ? jobQueueIndex : (start + k) % n;
+        if (k >= 0 && idx == jobQueueIndex) continue;
+        JobQueue& q = *jobSystem.queues[idx];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.jobs.empty()) continue;
+        if (only) {
+            auto it = std::find_if(q.jobs.begin(), q.jobs.end(), [only](const Job& j) { return j.counter == only; });
+            if (it == q.jobs.end()) continue;
+            job = std::move(*it);
+            q.jobs.erase(it);
+        }
+        else if (k < 0) { job = std::move(q.jobs.back()); q.jobs.pop_back(); }
+        else { job = std::move(q.jobs.front()); q.jobs.pop_front(); }
+        jobSystem.queued--;
+        return true;
     }
+    return false;
+}
 
-    glDisable(GL_LINE_SMOOTH);
-    glDisable(GL_BLEND);
-
-    glPopMatrix();
-    glMatrixMode(GL_PROJECTION);
-    glPopMatrix();
-    glMatrixMode(GL_MODELVIEW);
-
-    glEnable(GL_DEPTH_TEST);
+void FinishJob(JobCounter* counter) {
+    if (!counter) return;
+    std::vector<Job> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        if (--counter->pending == 0) ready.swap(counter->continuations);
+    }
+    for (Job& j : ready) PushJob(std::move(j));
 }
 
-void FlipHorizontalUVs(Shape* s) {
-    if (s == NULL) return;
+bool RunOneJob(JobCounter* only = NULL) {
+    Job job;
+    if (!TakeJob(job, only)) return false;
+    job.fn();
+    FinishJob(job.counter);
+    return true;
+}
 
-    // UV ǥ { u, v, u, v ... }  
-    // ¦ ε(0, 2, 4...) u ǥ Ŵ (1.0 - u)
-    for (size_t i = 0; i < s->uvs.size(); i += 2) {
-        s->uvs[i] = 1.0f - s->uvs[i];
+void JobWorkerMain(int index) {
+    jobQueueIndex = index;
+    for (;;) {
+        if (RunOneJob()) continue;
+        std::unique_lock<std::mutex> lock(jobSystem.sleepMutex);
+        jobSystem.wake.wait(lock, [] { return jobSystem.quit || jobSystem.queued > 0; });
+        if (jobSystem.quit) return;
     }
+}
 
-    //  UV ǥ GPU ۿ Ʈ
-    if (s->TBO != 0) {
-        glBindBuffer(GL_ARRAY_BUFFER, s->TBO);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, s->uvs.size() * sizeof(float), s->uvs.data());
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+// counter ۾    ־  (WaitJobs ٸ  )
+void SubmitJob(std::function<void()> fn, JobCounter* counter = NULL, JobCounter* after = NULL) {
+    if (counter) counter->pending++;
+    Job job = { std::move(fn), counter };
+    if (after) {
+        std::lock_guard<std::mutex> lock(after->mutex);
+        if (after->pending > 0) { after->continuations.push_back(std::move(job)); return; }
     }
+    PushJob(std::move(job));
 }
 
-Shape* MakePoster(std::vector<Shape>& list, float x, float y, float z, float width, float height, char axis, int direction, GLuint texID) {
-    Shape s;
-    s.shapeType = 'p'; // poster
-    s.primitiveType = GL_TRIANGLES;
-    s.specificTextureID = texID;
-    s.color[0] = 1.0f; s.color[1] = 1.0f; s.color[2] = 1.0f;
-    s.x = x; s.y = y; s.z = z;
+// īͰ 0   ٸ   ī  ۾  
+void WaitJobs(JobCounter& counter) {
+    while (counter.pending > 0) {
+        if (!RunOneJob(&counter)) std::this_thread::yield();
+    }
+    std::lock_guard<std::mutex> lock(counter.mutex); //  FinishJob ī͸  
+}
 
-    float w = width / 2.0f;
-    float h = height / 2.0f;
+int JobWorkerCount() {
+    return (int)jobSystem.workers.size();
+}
 
-    // 1. (Vertex) 
-    if (axis == 'z') { // /  ٴ 
-        // direction: 1̸ Z+ (), -1̸ Z- (ĸ) ٶ
-        // 츮  '' ٿ ϹǷ,  Z-  ʹ Z+  .
-        if (direction == 1) {
-            // Z+  (κ   پ   - 1 )
-            s.vertices = { -w,-h,0,  w,-h,0,  w, h,0,  -w,-h,0,  w, h,0,  -w, h,0 };
-            s.normals = { 0, 0,1,  0, 0,1,  0, 0,1,   0, 0,1,  0, 0,1,   0, 0,1 };
-        }
-        else {
-            // Z-  (κ   پ ڸ  - 4 )
-            s.vertices = { w,-h,0, -w,-h,0, -w, h,0,   w,-h,0, -w, h,0,   w, h,0 };
-            s.normals = { 0, 0,-1, 0, 0,-1, 0, 0,-1,  0, 0,-1, 0, 0,-1,  0, 0,-1 };
-        }
-    }
-    else if (axis == 'x') { // /  ٴ 
-        if (direction == 1) {
-            // X+  (κ   پ   - 2 )
-            s.vertices = { 0,-h, w,  0,-h,-w,  0, h,-w,  0,-h, w,  0, h,-w,  0, h, w };
-            s.normals = { 1, 0, 0,  1, 0, 0,  1, 0, 0,  1, 0, 0,  1, 0, 0,  1, 0, 0 };
-        }
-        else {
-            // X-  (κ   پ   - 3 )
-            s.vertices = { 0,-h,-w,  0,-h, w,  0, h, w,  0,-h,-w,  0, h, w,  0, h,-w };
-            s.normals = { -1,0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0 };
-        }
+// [begin, end) grain ̻ ũ    - fn(lo, hi),   ȯ
+void ParallelFor(int begin, int end, int grain, const std::function<void(int, int)>& fn) {
+    int count = end - begin;
+    if (count <= 0) return;
+    int chunks = std::min((count + grain - 1) / std::max(1, grain), std::max(1, JobWorkerCount() * 4));
+    if (chunks <= 1 || JobWorkerCount() == 0) { fn(begin, end); return; }
+
+    JobCounter counter;
+    for (int c = 1; c < chunks; ++c) {
+        int lo = begin + (int)((long long)count * c / chunks);
+        int hi = begin + (int)((long long)count * (c + 1) / chunks);
+        SubmitJob([&fn, lo, hi] { fn(lo, hi); }, &counter);
     }
+    fn(begin, begin + (int)((long long)count / chunks)); // ù  θ 尡 
+    WaitJobs(counter);
+}
 
-    // 2. ؽó ǥ (UV) -  (Flip) 
-    s.uvs = {
-        0.0f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f,
-        0.0f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f
-    };
+void StopJobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(jobSystem.sleepMutex);
+        jobSystem.quit = true;
+    }
+    jobSystem.wake.notify_all();
+    for (std::thread& t : jobSystem.workers) t.join();
+    jobSystem.workers.clear();
+    jobSystem.queues.clear();
+    jobSystem.queued = 0;
+    jobSystem.quit = false;
+}
 
-    s.vertexCount = 6;
+// workers ۾   (̹  ߰ ٽ - --bench-sim Ȯ强 )
+void StartJobSystem(int workers) {
+    static bool registered = false;
+    if (!jobSystem.queues.empty()) StopJobSystem();
+    for (int i = 0; i <= workers; ++i) jobSystem.queues.push_back(std::unique_ptr<JobQueue>(new JobQueue()));
+    for (int i = 1; i <= workers; ++i) jobSystem.workers.push_back(std::thread(JobWorkerMain, i));
+    if (!registered) { atexit(StopJobSystem); registered = true; }
+}
 
-    setupShapeBuffers(s, s.vertices, s.colors, s.normals);
-    list.push_back(s);
-    return &list.back();
+int DefaultJobWorkers() {
+    if (jobSystem.requestedWorkers >= 0) return jobSystem.requestedWorkers;
+    return std::max(1, (int)std::thread::hardware_concurrency() - 1);
 }
 
-void main(int argc, char** argv)
-{
-    //  õ
-    //srand((unsigned int)time(NULL));
-    //   õ
-    srand(mapSeed);
+// --- 񵿱 ؽó δ ---
+// ڵ(stbi_load) ۾ ٷ, ε GL (PollTextureUploads) ó
+//
+// [߰] ؽó ĳ (<>.rtex)
+// ù   Ӹ ü (ϸ BPTC )  ΰ,
+//  ʹ PNG ڵ glGenerateMipmap   ٷ ε
+//
+// [] ؽó 迭 (GL_TEXTURE_2D_ARRAY)
+//  ؽó  迭 ̾ 
+// ׸ ߿ 迭   εϰ ̾ ȣ(uniform /  Ӽ) 
+// ε  ̾ textureLayerReady false -> objectColor ׸
+// [] ̾ ũ    ū / -   ʰ   ΰ  ڸ  ä
+// ̴ ̾ UV (textureLayerScale)    Ƿ Ⱦ 
+struct TextureLevel {
+    int width = 0, height = 0;
+    std::vector<unsigned char> bytes;
+};
 
-    glutInit(&argc, argv);
-    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
-    glutInitWindowPosition(100, 100);
-    glutInitWindowSize(g_width, g_height);
-    glutCreateWindow("ROCK UP - Jump to Fall");
+struct TextureJob {
+    int layer = 0;
+    std::string path;
+    bool compressed = false;  // levels   
+    bool fromCache = false;   // .rtex ĳÿ о (false ù  -> ĳ )
+    int64_t srcSize = 0, srcTime = 0; //   ũ/ ð (ĳ ȿȭ)
+    int srcWidth = 0, srcHeight = 0;  // [߰]  ̹ ũ (stbi_info,    0)
+    std::vector<TextureLevel> levels;
+};
 
-    glewExperimental = GL_TRUE;
-    if (glewInit() != GLEW_OK) return;
+const int MAX_TEXTURE_LAYERS = 16;     // vertex.glsl layerScale 迭 ũ  (Ӹ #define)
+const uint32_t TEXTURE_CACHE_VERSION = 3; // [] 3: ̾ ũⰡ  ִ ũ (簢  ƴ)
+
+GLuint textureArrayID = 0;
+GLenum textureArrayFormat = GL_RGBA8;  //  ̾   
+int textureArrayWidth = 1, textureArrayHeight = 1; // [߰] ̾ ũ (StartTextureWorkers )
+int textureArrayLevels = 1;
+int textureLayerCount = 0;
+float textureLayerScale[MAX_TEXTURE_LAYERS][2]; // [߰] ̾ UV  ( / ̾ ũ)
+std::atomic<bool> textureLayerReady[MAX_TEXTURE_LAYERS] = {}; // []  غ 嵵 
+std::atomic<uint32_t> textureBatchLayers{ 0 }; // [߰] ؽó  ۰  ̾ Ʈ (BuildStaticBatch)
+bool textureCacheCompress = true;      //    (̹  )
+
+struct TextureCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t internalFormat;
+    uint32_t compressed;
+    uint32_t levelCount;
+    int64_t srcSize;
+    int64_t srcTime;
+};
 
-    make_vertexShaders();
-    make_fragmentShaders();
-    shaderProgramID = make_shaderProgram();
+std::deque<TextureJob> texturePending;  // ڵ 
+std::deque<TextureJob> textureDecoded;  // ε 
+std::mutex textureMutex;
+std::atomic<int> textureJobsInFlight{ 0 }; //  ε  ۾ 
+const int TEXTURE_UPLOADS_PER_FRAME = 2; //  ӿ ε ִ 
 
-    // [߰] ؽó ε   
-    rockTextureID = loadTexture("rock.png");
-    wallTextureID = loadTexture("background.png");
+//  ð / ؽó ޸ 
+int textureLoadStartTime = 0;
+size_t textureMemoryBytes = 0;
 
-    texCtrl1 = loadTexture("game_ctrl1.png"); // WASD
-    texCtrl2 = loadTexture("game_ctrl2.png"); // Space
-    texCtrl3 = loadTexture("game_ctrl3.png"); // Mouse
-    texCtrl4 = loadTexture("game_ctrl4.png"); // Reset/Goal
+std::string TextureCachePath(const std::string& path) {
+    return path + ".rtex";
+}
 
-    glUseProgram(shaderProgramID);
-    glUniform1i(glGetUniformLocation(shaderProgramID, "texture1"), 0); // ؽó  0
+// [߰] ˺   Ʈ  (ĳ , GPU ޸ )
+size_t TextureLevelBytes(GLenum format, int width, int height) {
+    switch (format) {
+    case GL_COMPRESSED_RGBA_BPTC_UNORM: return (size_t)((width + 3) / 4) * ((height + 3) / 4) * 16; // 4x4 ϴ 16Ʈ
+    case GL_R8: return (size_t)width * height;
+    case GL_RG8: return (size_t)width * height * 2;
+    default: return (size_t)width * height * 4; // GL_RGBA8
+    }
+}
 
-    glutDisplayFunc(drawScene);
-    glutReshapeFunc(Reshape);
-    glutKeyboardFunc(Keyboard);
-    glutKeyboardUpFunc(KeyboardUp);
-    glutMouseFunc(Mouse);
-    glutMotionFunc(Motion);
+// [] RGBA ̹   ̾   ϰ,    / 
+// (Ӹʰ ּ Ͱ  ڸ ٱ    ʵ)
+TextureLevel PadToLayer(const unsigned char* data, int width, int height) {
+    TextureLevel dst;
+    dst.width = textureArrayWidth; dst.height = textureArrayHeight;
+    dst.bytes.resize((size_t)dst.width * dst.height * 4);
+
+    int w = std::min(width, dst.width), h = std::min(height, dst.height);
+    for (int y = 0; y < dst.height; ++y) {
+        const unsigned char* src = data + (size_t)std::min(y, h - 1) * width * 4;
+        unsigned char* row = dst.bytes.data() + (size_t)y * dst.width * 4;
+        memcpy(row, src, (size_t)w * 4);
+        for (int x = w; x < dst.width; ++x) memcpy(row + (size_t)x * 4, src + (size_t)(w - 1) * 4, 4);
+    }
+    return dst;
+}
 
-    GenerateLobby();
+// CPU Ӹ  (2x2 ڽ , RGBA)
+void BuildMipChain(TextureJob& job) {
+    while (job.levels.back().width > 1 || job.levels.back().height > 1) {
+        const TextureLevel& src = job.levels.back();
+        TextureLevel dst;
+        dst.width = std::max(1, src.width / 2);
+        dst.height = std::max(1, src.height / 2);
+        dst.bytes.resize((size_t)dst.width * dst.height * 4);
+
+        for (int y = 0; y < dst.height; ++y) {
+            int y0 = std::min(y * 2, src.height - 1), y1 = std::min(y * 2 + 1, src.height - 1);
+            for (int x = 0; x < dst.width; ++x) {
+                int x0 = std::min(x * 2, src.width - 1), x1 = std::min(x * 2 + 1, src.width - 1);
+                for (int c = 0; c < 4; ++c) {
+                    int sum = src.bytes[((size_t)y0 * src.width + x0) * 4 + c]
+                        + src.bytes[((size_t)y0 * src.width + x1) * 4 + c]
+                        + src.bytes[((size_t)y1 * src.width + x0) * 4 + c]
+                        + src.bytes[((size_t)y1 * src.width + x1) * 4 + c];
+                    dst.bytes[((size_t)y * dst.width + x) * 4 + c] = (unsigned char)((sum + 2) / 4);
+                }
+            }
+        }
+        job.levels.push_back(dst);
+    }
+}
 
-    Shape* pShape = ShapeSave(shapes, '1', 1.0f, 0.2f, 0.2f, rock.radius, rock.radius, rock.radius);
-    playerShapeIndex = shapes.size() - 1;
+// ĳ б -  ٲų 迭 /ũ ٸ false
+// []  ũ(̾ ũ >> i) Ʈ ( ) Ȯ ڿ ۸ 
+bool ReadTextureCache(TextureJob& job) {
+    FILE* f = fopen(TextureCachePath(job.path).c_str(), "rb");
+    if (!f) return false;
+
+    TextureCacheHeader h;
+    bool ok = fread(&h, sizeof(h), 1, f) == 1
+        && memcmp(h.magic, "RTEX", 4) == 0
+        && h.version == TEXTURE_CACHE_VERSION
+        && h.srcSize == job.srcSize && h.srcTime == job.srcTime
+        && h.internalFormat == textureArrayFormat
+        && (h.compressed != 0) == (textureArrayFormat != GL_RGBA8)
+        && (int)h.levelCount == textureArrayLevels;
+
+    for (uint32_t i = 0; ok && i < h.levelCount; ++i) {
+        uint32_t dims[3];
+        ok = fread(dims, sizeof(dims), 1, f) == 1;
+        if (!ok) break;
+        int width = std::max(1, textureArrayWidth >> i), height = std::max(1, textureArrayHeight >> i);
+        ok = dims[0] == (uint32_t)width && dims[1] == (uint32_t)height
+            && dims[2] == TextureLevelBytes(textureArrayFormat, width, height);
+        if (!ok) break;
+        TextureLevel level;
+        level.width = dims[0]; level.height = dims[1];
+        level.bytes.resize(dims[2]);
+        ok = fread(level.bytes.data(), 1, dims[2], f) == dims[2];
+        job.levels.push_back(level);
+    }
+    fclose(f);
 
-    glutTimerFunc(16, TimerFunction, 0);
-    glutMainLoop();
+    if (!ok) { job.levels.clear(); return false; }
+    job.compressed = h.compressed != 0;
+    job.fromCache = true;
+    return true;
 }
 
-// ---  Լ ---
-void ResetGame() {
-    currentState = LOBBY;
-    rock.Reset();
-    isDoorOpen = false; // ٴ ݱ
-
-    // Ÿ̸ ʱȭ
-    isTimerRunning = false;
-    gameTime = 0.0f;
+void WriteTextureCache(const TextureJob& job) {
+    FILE* f = fopen(TextureCachePath(job.path).c_str(), "wb");
+    if (!f) return;
+
+    TextureCacheHeader h;
+    memcpy(h.magic, "RTEX", 4);
+    h.version = TEXTURE_CACHE_VERSION;
+    h.internalFormat = textureArrayFormat;
+    h.compressed = job.compressed ? 1 : 0;
+    h.levelCount = (uint32_t)job.levels.size();
+    h.srcSize = job.srcSize;
+    h.srcTime = job.srcTime;
+    fwrite(&h, sizeof(h), 1, f);
+
+    for (const auto& level : job.levels) {
+        uint32_t dims[3] = { (uint32_t)level.width, (uint32_t)level.height, (uint32_t)level.bytes.size() };
+        fwrite(dims, sizeof(dims), 1, f);
+        fwrite(level.bytes.data(), 1, level.bytes.size(), f);
+    }
+    fclose(f);
+}
 
-    srand(mapSeed);
+// [] ۾ ϳ ؽó ϳ - ⿭ տ  ڵ (   ۾ ٷ)
+void DecodeNextTexture() {
+    TextureJob job;
+    {
+        std::lock_guard<std::mutex> lock(textureMutex);
+        if (texturePending.empty()) return;
+        job = texturePending.front();
+        texturePending.pop_front();
+    }
 
-    mapShapes.clear();
-    mapBlocks.clear();
+    struct stat st;
+    if (stat(job.path.c_str(), &st) == 0) {
+        job.srcSize = st.st_size;
+        job.srcTime = st.st_mtime;
+    }
 
-    // κ ٴ() ġ 󺹱
-    for (auto& s : lobbyShapes) {
-        if (s.isDoor) {
-            s.x = s.initX;
-            s.y = s.initY;
-            s.z = s.initZ;
+    if (!ReadTextureCache(job)) {
+        int width, height, nrComponents;
+        unsigned char* data = stbi_load(job.path.c_str(), &width, &height, &nrComponents, 4);
+        if (data) {
+            job.levels.push_back(PadToLayer(data, width, height));
+            stbi_image_free(data);
+            BuildMipChain(job);
         }
     }
 
-    cameraYaw = 270.0f;
-    cameraPitch = 20.0f;
+    std::lock_guard<std::mutex> lock(textureMutex);
+    textureDecoded.push_back(job);
 }
 
-// --- ݹ Լ ---
-GLvoid Keyboard(unsigned char key, int x, int y) {
-    keyState[key] = true;
-    if (key == '1') {
-        camera_mode = 1;
-    }
-    if (key == '2')
-    {
-        camera_mode = 2;
+// ̾ ȣ ϰ ڵ ⿭ ߰ (StartTextureWorkers  ȣ)
+int loadTextureAsync(const char* path) {
+    if (textureLayerCount >= MAX_TEXTURE_LAYERS) {
+        printf("Texture layer limit reached: %s\n", path);
+        return -1;
     }
 
-    if (key == 'q' || key == 'Q') exit(0);
-    if (key == 'r' || key == 'R') ResetGame();
-
-    if (key == 'g' || key == 'G') {
-        printf("DEBUG: Teleport to Goal!\n");
+    TextureJob job;
+    job.layer = textureLayerCount++;
+    job.path = path;
+    int components;
+    if (!stbi_info(path, &job.srcWidth, &job.srcHeight, &components)) job.srcWidth = job.srcHeight = 0;
 
-        //  κ񿡼 ٷ ٸ   ·    
-        if (currentState != PLAYING) {
-            currentState = PLAYING;
-            GenerateMap(); // ʰ  (Ȳ ) 
-
-            // Ÿ̸   (׽Ʈ)
-            if (!isTimerRunning) {
-                startTime = glutGet(GLUT_ELAPSED_TIME);
-                isTimerRunning = true;
-                gameTime = 0.0f;
-            }
-        }
+    std::lock_guard<std::mutex> lock(textureMutex);
+    texturePending.push_back(job);
+    textureJobsInFlight++;
+    return job.layer;
+}
 
-        // ǥ  ǥ  (GenerateMap Լ  )
-        // goalY = (MAP_HEIGHT * 3.0f) + 5.0f; -> 150 * 3 + 5 = 455.0f
-        float goalY = (150 * 3.0f) + 25.0f;
+// ؽó 迭 Ҵ    ؽó ۾ ϳ  (loadTextureAsync ȣ   )
+void StartTextureWorkers() {
+    textureLoadStartTime = GetElapsedMs();
 
-        // ÷̾ ǥ (455) ¦ (465) ̵
-        rock.position = glm::vec3(0.0f, goalY + 10.0f, 0.0f);
+    bool bptcSupported = GLEW_ARB_texture_compression_bptc || GLEW_VERSION_4_2;
+    textureArrayFormat = (textureCacheCompress && bptcSupported) ? GL_COMPRESSED_RGBA_BPTC_UNORM : GL_RGBA8;
 
-        // 鼭 浹ϵ ӵ ʱȭ
-        rock.velocity = glm::vec3(0.0f, 0.0f, 0.0f);
+    // [] ̾ ũ =  ִ / (  4x4   ø)
+    {
+        std::lock_guard<std::mutex> lock(textureMutex);
+        textureArrayWidth = textureArrayHeight = 1;
+        for (const auto& job : texturePending) {
+            textureArrayWidth = std::max(textureArrayWidth, job.srcWidth);
+            textureArrayHeight = std::max(textureArrayHeight, job.srcHeight);
+        }
+        if (textureArrayFormat != GL_RGBA8) {
+            textureArrayWidth = (textureArrayWidth + 3) & ~3;
+            textureArrayHeight = (textureArrayHeight + 3) & ~3;
+        }
+        for (int i = 0; i < MAX_TEXTURE_LAYERS; ++i) textureLayerScale[i][0] = textureLayerScale[i][1] = 1.0f;
+        for (const auto& job : texturePending) {
+            if (job.srcWidth <= 0 || job.srcHeight <= 0) continue;
+            textureLayerScale[job.layer][0] = (float)job.srcWidth / textureArrayWidth;
+            textureLayerScale[job.layer][1] = (float)job.srcHeight / textureArrayHeight;
+        }
     }
 
-    if (key == ' ') {
-        if (rock.isGrounded) {
-            float speed = sqrt(rock.velocity.x * rock.velocity.x + rock.velocity.z * rock.velocity.z);
-            float bonus = speed * 1.2f;
-            rock.velocity.y = rock.jumpForce + bonus;
+    textureArrayLevels = 1;
+    for (int s = std::max(textureArrayWidth, textureArrayHeight); s > 1; s /= 2) textureArrayLevels++;
 
-            // [] κ񿡼 ϸ ٴ  Ʈ ۵
-            if (currentState == LOBBY) {
-                isDoorOpen = true;
-            }
+    glGenTextures(1, &textureArrayID);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, textureArrayID);
+    // [] ϸ Һ ҷ   Ҵ ( glTexImage3D(NULL) ̹  Ź ٽ ˻)
+    int layers = std::max(1, textureLayerCount);
+    if (GLEW_ARB_texture_storage || GLEW_VERSION_4_2) {
+        glTexStorage3D(GL_TEXTURE_2D_ARRAY, textureArrayLevels, textureArrayFormat, textureArrayWidth, textureArrayHeight, layers);
+    }
+    else {
+        for (int i = 0; i < textureArrayLevels; ++i) {
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, i, textureArrayFormat, std::max(1, textureArrayWidth >> i), std::max(1, textureArrayHeight >> i), layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        }
+    }
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, textureArrayLevels - 1);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    int jobs;
+    {
+        std::lock_guard<std::mutex> lock(textureMutex);
+        jobs = (int)texturePending.size();
+    }
+    for (int i = 0; i < jobs; ++i) {
+        SubmitJob(DecodeNextTexture);
+    }
+}
+
+// ù  +  : ӽ 2D ؽó ÷ ̹   ޾ 
+void CompressTextureLevels(TextureJob& job) {
+    GLuint scratch;
+    glGenTextures(1, &scratch);
+    glBindTexture(GL_TEXTURE_2D, scratch);
+
+    for (int i = 0; i < (int)job.levels.size(); ++i) {
+        TextureLevel& level = job.levels[i];
+        glTexImage2D(GL_TEXTURE_2D, i, textureArrayFormat, level.width, level.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, level.bytes.data());
+
+        GLint size = 0;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, i, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+        level.bytes.resize(size);
+        glGetCompressedTexImage(GL_TEXTURE_2D, i, level.bytes.data());
+    }
+    job.compressed = true;
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDeleteTextures(1, &scratch);
+}
+
+// غ   迭 ش ̾ ״ ε (glGenerateMipmap )
+void UploadTextureLayer(TextureJob& job) {
+    if (!job.fromCache) {
+        if (textureArrayFormat != GL_RGBA8) CompressTextureLevels(job);
+        WriteTextureCache(job);
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, textureArrayID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int i = 0; i < (int)job.levels.size(); ++i) {
+        const TextureLevel& level = job.levels[i];
+        if (job.compressed) {
+            glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, i, 0, 0, job.layer, level.width, level.height, 1, textureArrayFormat, (GLsizei)level.bytes.size(), level.bytes.data());
+        }
+        else {
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, i, 0, 0, job.layer, level.width, level.height, 1, GL_RGBA, GL_UNSIGNED_BYTE, level.bytes.data());
+        }
+        // GPU ޸  (迭   )
+        textureMemoryBytes += TextureLevelBytes(textureArrayFormat, level.width, level.height);
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    textureLayerReady[job.layer] = true;
+}
+
+// ڵ  ؽó ε (  ȣ, GL )
+void PollTextureUploads() {
+    if (textureJobsInFlight == 0) return;
+
+    for (int i = 0; i < TEXTURE_UPLOADS_PER_FRAME; ++i) {
+        TextureJob job;
+        {
+            std::lock_guard<std::mutex> lock(textureMutex);
+            if (textureDecoded.empty()) return;
+            job = std::move(textureDecoded.front());
+            textureDecoded.pop_front();
+        }
+
+        if (!job.levels.empty()) {
+            UploadTextureLayer(job);
+            printf("Texture loaded: %s (layer %d, %s)\n", job.path.c_str(), job.layer, job.fromCache ? "cache" : "decoded");
+        }
+        else {
+            printf("Texture failed to load at path: %s\n", job.path.c_str());
+        }
+
+        textureJobsInFlight--;
+        if (textureJobsInFlight == 0) {
+            printf("Textures ready: %d ms, %.1f MB GPU memory\n",
+                GetElapsedMs() - textureLoadStartTime, textureMemoryBytes / (1024.0 * 1024.0));
+            return;
+        }
+    }
+}
+
+// --- ؽƮ  (SDF ۸ Ʋ) ---
+// [] glutStrokeCharacter( )  ھ  ̴ ׸
+// ۸ Ʒ  Ʈ(4x6 ) Ÿ(SDF)  Ʋ  忡  
+//    ڿ VBO ϳ    ׸,  ٲ  ٽ ä
+const int GLYPH_CELL = 48;        // Ʋ  ũ (px)
+const float GLYPH_UNIT = 6.0f;    //  1ĭ = 6px
+const float GLYPH_HALF_WIDTH = 0.45f; // ȹ β  ( )
+const float GLYPH_SPREAD = 6.0f;  // Ÿ  (px)
+const int GLYPH_COLS = 16, GLYPH_ROWS = 4; // ' '(32) ~ '_'(95)
+
+// ȹ :  ̾ , '|' ȹ 
+const char* GetGlyphStrokes(char c) {
+    switch (c) {
+    case '0': return "0 0 4 0 4 6 0 6 0 0";
+    case '1': return "1 5 2 6 2 0|1 0 3 0";
+    case '2': return "0 6 4 6 4 3 0 3 0 0 4 0";
+    case '3': return "0 6 4 6 4 0 0 0|0 3 4 3";
+    case '4': return "0 6 0 3 4 3|4 6 4 0";
+    case '5': return "4 6 0 6 0 3 4 3 4 0 0 0";
+    case '6': return "4 6 0 6 0 0 4 0 4 3 0 3";
+    case '7': return "0 6 4 6 4 0";
+    case '8': return "0 0 4 0 4 6 0 6 0 0|0 3 4 3";
+    case '9': return "4 3 0 3 0 6 4 6 4 0 0 0";
+    case 'A': return "0 0 0 4 2 6 4 4 4 0|0 3 4 3";
+    case 'B': return "0 0 0 6 3 6 4 5 4 4 3 3 0 3|3 3 4 2 4 1 3 0 0 0";
+    case 'C': return "4 6 0 6 0 0 4 0";
+    case 'D': return "0 0 0 6 2 6 4 4 4 2 2 0 0 0";
+    case 'E': return "4 6 0 6 0 0 4 0|0 3 3 3";
+    case 'F': return "4 6 0 6 0 0|0 3 3 3";
+    case 'G': return "4 6 0 6 0 0 4 0 4 3 2 3";
+    case 'H': return "0 0 0 6|4 0 4 6|0 3 4 3";
+    case 'I': return "1 6 3 6|2 6 2 0|1 0 3 0";
+    case 'J': return "4 6 4 0 0 0 0 2";
+    case 'K': return "0 0 0 6|4 6 0 3 4 0";
+    case 'L': return "0 6 0 0 4 0";
+    case 'M': return "0 0 0 6 2 3 4 6 4 0";
+    case 'N': return "0 0 0 6 4 0 4 6";
+    case 'O': return "0 0 4 0 4 6 0 6 0 0";
+    case 'P': return "0 0 0 6 4 6 4 3 0 3";
+    case 'Q': return "0 0 4 0 4 6 0 6 0 0|2 2 4 -1";
+    case 'R': return "0 0 0 6 4 6 4 3 0 3 4 0";
+    case 'S': return "4 6 0 6 0 3 4 3 4 0 0 0";
+    case 'T': return "0 6 4 6|2 6 2 0";
+    case 'U': return "0 6 0 0 4 0 4 6";
+    case 'V': return "0 6 2 0 4 6";
+    case 'W': return "0 6 1 0 2 3 3 0 4 6";
+    case 'X': return "0 0 4 6|0 6 4 0";
+    case 'Y': return "0 6 2 3 4 6|2 3 2 0";
+    case 'Z': return "0 6 4 6 0 0 4 0";
+    case ':': return "2 1 2 1.3|2 4 2 4.3";
+    case '.': return "2 0 2 0.3";
+    case '!': return "2 6 2 2|2 0 2 0.3";
+    case '-': return "1 3 3 3";
+    case '/': return "0 0 4 6";
+    case '%': return "0 0 4 6|0 5.5 0 6|4 0 4 0.5";
+    default: return "";
+    }
+}
+
+// []  Ӱ    ڰ  ۸  ٽ  
+// ó ޶ ȣ ڸ ߶  ٽ ä (ڿ  Ű  )
+struct TextCall {
+    float x, y, r, g, b, scale;
+    std::string text;
+    size_t vertexEnd;             //  ȣ vertices 
+};
+
+struct TextRenderer {
+    GLuint program = 0;
+    GLuint atlas = 0;
+    GLuint VAO = 0, VBO = 0;
+    std::vector<float> vertices;  // x, y, u, v, r, g, b
+    std::vector<TextCall> calls;  // vertices  ȣ 
+    size_t callIndex = 0;         // ̹ ӿ  ° ȣ
+    bool changed = true;          // ̹ ӿ vertices ٲ -> DrawHudText VBO 
+    int vertexCount = 0;
+    bool ready = false;           // [߰] ̴ ũ Ϸ
+};
+TextRenderer hudText;
+
+GLuint make_textShaderProgram(ProgramReadyFn onReady);
+
+//  p  ab  Ÿ
+float SegmentDistance(float px, float py, float ax, float ay, float bx, float by) {
+    float dx = bx - ax, dy = by - ay;
+    float len2 = dx * dx + dy * dy;
+    float t = (len2 > 0.0f) ? std::max(0.0f, std::min(1.0f, ((px - ax) * dx + (py - ay) * dy) / len2)) : 0.0f;
+    float qx = ax + t * dx - px, qy = ay + t * dy - py;
+    return sqrtf(qx * qx + qy * qy);
+}
+
+void InitTextRenderer() {
+    int atlasW = GLYPH_COLS * GLYPH_CELL, atlasH = GLYPH_ROWS * GLYPH_CELL;
+    std::vector<unsigned char> pixels((size_t)atlasW * atlasH, 0);
+
+    for (int ch = 32; ch < 32 + GLYPH_COLS * GLYPH_ROWS; ++ch) {
+        // ȹ ڿ ->   ( )
+        std::vector<float> segs;
+        std::vector<float> pts;
+        std::string strokes = GetGlyphStrokes((char)ch);
+        strokes += '|';
+        std::string num;
+        for (char c : strokes) {
+            if (c == ' ' || c == '|') {
+                if (!num.empty()) { pts.push_back((float)atof(num.c_str())); num.clear(); }
+                if (c == '|') {
+                    for (size_t i = 2; i + 1 < pts.size(); i += 2) {
+                        segs.insert(segs.end(), { pts[i - 2], pts[i - 1], pts[i], pts[i + 1] });
+                    }
+                    pts.clear();
+                }
+            }
+            else num += c;
+        }
+        if (segs.empty()) continue;
+
+        //    :  2ĭ, Ʒ 1ĭ 
+        int cellX = ((ch - 32) % GLYPH_COLS) * GLYPH_CELL;
+        int cellY = ((ch - 32) / GLYPH_COLS) * GLYPH_CELL;
+        for (int py = 0; py < GLYPH_CELL; ++py) {
+            for (int px = 0; px < GLYPH_CELL; ++px) {
+                float gx = (px + 0.5f) / GLYPH_UNIT - 2.0f;
+                float gy = (py + 0.5f) / GLYPH_UNIT - 1.0f;
+                float dist = 1e9f;
+                for (size_t i = 0; i < segs.size(); i += 4) {
+                    dist = std::min(dist, SegmentDistance(gx, gy, segs[i], segs[i + 1], segs[i + 2], segs[i + 3]));
+                }
+                float d = (GLYPH_HALF_WIDTH - dist) * GLYPH_UNIT / GLYPH_SPREAD; // 迡 0
+                float v = std::max(0.0f, std::min(1.0f, 0.5f + d * 0.5f));
+                pixels[(size_t)(cellY + py) * atlasW + cellX + px] = (unsigned char)(v * 255.0f + 0.5f);
+            }
+        }
+    }
+
+    // Ʋ󽺴 ؽó  1  ( 0 ؽó 迭)
+    glActiveTexture(GL_TEXTURE1);
+    glGenTextures(1, &hudText.atlas);
+    glBindTexture(GL_TEXTURE_2D, hudText.atlas);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, atlasW, atlasH, 0, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+    textureMemoryBytes += TextureLevelBytes(GL_R8, atlasW, atlasH);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glActiveTexture(GL_TEXTURE0);
+
+    make_textShaderProgram([](GLuint program, bool ok) {
+        if (!ok) FailRequiredProgram("text");
+        hudText.program = program;
+        glUseProgram(program);
+        glUniform1i(glGetUniformLocation(program, "glyphAtlas"), 1);
+        glUseProgram(0);
+        hudText.ready = ok;
+    });
+
+    glGenVertexArrays(1, &hudText.VAO);
+    glGenBuffers(1, &hudText.VBO);
+    glBindVertexArray(hudText.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, hudText.VBO);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+    glBindVertexArray(0);
+}
+
+// ̹ ӿ ׸ ڿ  
+void BeginHudText() {
+    hudText.callIndex = 0;
+}
+
+// ؽƮ  Լ (ϴ  ȼ ǥ, scale  stroke Ʈ )
+void RenderText(float x, float y, const char* text, float r, float g, float b, float scale) {
+    // []     ȣ ڰ   ̹ 
+    size_t index = hudText.callIndex++;
+    if (index < hudText.calls.size()) {
+        const TextCall& prev = hudText.calls[index];
+        if (prev.x == x && prev.y == y && prev.r == r && prev.g == g && prev.b == b && prev.scale == scale
+            && strcmp(prev.text.c_str(), text) == 0) return;
+        hudText.vertices.resize(index > 0 ? hudText.calls[index - 1].vertexEnd : 0);
+        hudText.calls.resize(index);
+    }
+    hudText.changed = true;
+
+    // stroke Ʈ 빮 ( 100 ) =  6ĭ
+    float unit = 100.0f * scale / 6.0f;
+    float cell = GLYPH_CELL / GLYPH_UNIT * unit;
+    float pen = x;
+    for (const char* c = text; *c != '\0'; c++) {
+        int ch = toupper((unsigned char)*c);
+        if (ch >= 32 && ch < 32 + GLYPH_COLS * GLYPH_ROWS && ch != ' ') {
+            float u0 = (float)((ch - 32) % GLYPH_COLS) / GLYPH_COLS, u1 = u0 + 1.0f / GLYPH_COLS;
+            float v0 = (float)((ch - 32) / GLYPH_COLS) / GLYPH_ROWS, v1 = v0 + 1.0f / GLYPH_ROWS;
+            float x0 = pen - 2.0f * unit, y0 = y - 1.0f * unit;
+            float x1 = x0 + cell, y1 = y0 + cell;
+            hudText.vertices.insert(hudText.vertices.end(), {
+                x0, y0, u0, v0, r, g, b,  x1, y0, u1, v0, r, g, b,  x1, y1, u1, v1, r, g, b,
+                x0, y0, u0, v0, r, g, b,  x1, y1, u1, v1, r, g, b,  x0, y1, u0, v1, r, g, b });
+        }
+        pen += 6.0f * unit; //  4ĭ +  2ĭ
+    }
+    TextCall call = { x, y, r, g, b, scale, text, hudText.vertices.size() };
+    hudText.calls.push_back(call);
+}
+
+//  ڿ   ׸ -  ٲ 쿡 VBO 
+void DrawHudText() {
+    //  Ӻ ȣ    ߶ 
+    if (hudText.callIndex < hudText.calls.size()) {
+        hudText.vertices.resize(hudText.callIndex > 0 ? hudText.calls[hudText.callIndex - 1].vertexEnd : 0);
+        hudText.calls.resize(hudText.callIndex);
+        hudText.changed = true;
+    }
+    if (hudText.changed) {
+        glBindBuffer(GL_ARRAY_BUFFER, hudText.VBO);
+        glBufferData(GL_ARRAY_BUFFER, hudText.vertices.size() * sizeof(float), hudText.vertices.data(), GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        hudText.vertexCount = (int)hudText.vertices.size() / 7;
+        hudText.changed = false;
+    }
+    if (hudText.vertexCount == 0 || !hudText.ready) return;
+
+    glViewport(0, 0, g_width, g_height); // ̴ϸ Ʈ    
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    glUseProgram(hudText.program);
+    glUniform2f(glGetUniformLocation(hudText.program, "screenSize"), (float)g_width, (float)g_height);
+    glBindVertexArray(hudText.VAO);
+    glDrawArrays(GL_TRIANGLES, 0, hudText.vertexCount);
+    renderStats.drawCalls++;
+    renderStats.triangles += hudText.vertexCount / 3;
+
+    glDisable(GL_BLEND);
+    glEnable(GL_DEPTH_TEST);
+}
+
+// ---  Ϸ ---
+// CPU  steady_clock, GPU  GL_TIME_ELAPSED  
+// GPU  PROFILE_FRAMES_IN_FLIGHT   ,  غ ͸  ( )
+// 'p' Ű ȭ  (ֱ PROFILE_HISTORY   / p99)
+enum ProfileScope {
+    PROF_PHYSICS,     // UpdatePhysics (ƽ )
+    PROF_MAIN_PASS,   //  ȭ RenderPass
+    PROF_MINIMAP_PASS,// ̴ϸ RenderPass
+    PROF_HUD,         // ؽƮ
+    PROF_OBJECTS,     // [] غ ڵ /   ε + ø ġ (CPU)
+    PROF_PREP,        // [߰]  غ  ׸  ۼ (   )
+    PROF_COUNT
+};
+const char* PROFILE_NAMES[PROF_COUNT] = { "PHYSICS", "MAIN", "MINIMAP", "HUD", "OBJECTS", "PREP" };
+const int PROFILE_HISTORY = 240;
+const int PROFILE_FRAMES_IN_FLIGHT = 4;
+
+struct ProfileHistory {
+    float samples[PROFILE_HISTORY] = { 0 };
+    int count = 0, head = 0;
+
+    void Add(float ms) {
+        samples[head] = ms;
+        head = (head + 1) % PROFILE_HISTORY;
+        if (count < PROFILE_HISTORY) count++;
+    }
+    void Stats(float& avg, float& p99) const {
+        avg = 0.0f; p99 = 0.0f;
+        if (count == 0) return;
+        float sorted[PROFILE_HISTORY];
+        for (int i = 0; i < count; ++i) { sorted[i] = samples[i]; avg += samples[i]; }
+        avg /= count;
+        std::sort(sorted, sorted + count);
+        p99 = sorted[std::min(count - 1, (int)(count * 0.99f))];
+    }
+};
+
+struct Profiler {
+    bool overlayVisible = false;
+    ProfileHistory cpu[PROF_COUNT];
+    ProfileHistory gpu[PROF_COUNT];
+
+    GLuint queries[PROFILE_FRAMES_IN_FLIGHT][PROF_COUNT] = { { 0 } };
+    bool queryPending[PROFILE_FRAMES_IN_FLIGHT][PROF_COUNT] = { { false } };
+    int frameSlot = 0;
+
+    std::vector<std::string> overlayLines;  // 250ms  (  ְ)
+    std::chrono::steady_clock::time_point overlayUpdated;
+};
+Profiler profiler;
+
+//   RAII - gpu true   Ÿ̸   ( ø Ұ)
+struct ProfileZone {
+    ProfileScope id;
+    bool gpu;
+    std::chrono::steady_clock::time_point start;
+
+    ProfileZone(ProfileScope scope, bool withGpu = false) : id(scope), gpu(false) {
+        if (withGpu && profiler.queries[0][0] != 0 && !profiler.queryPending[profiler.frameSlot][id]) {
+            glBeginQuery(GL_TIME_ELAPSED, profiler.queries[profiler.frameSlot][id]);
+            gpu = true;
+        }
+        start = std::chrono::steady_clock::now();
+    }
+    ~ProfileZone() {
+        profiler.cpu[id].Add(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+        if (gpu) {
+            glEndQuery(GL_TIME_ELAPSED);
+            profiler.queryPending[profiler.frameSlot][id] = true;
+        }
+    }
+};
+
+void InitProfiler() {
+    glGenQueries(PROFILE_FRAMES_IN_FLIGHT * PROF_COUNT, &profiler.queries[0][0]);
+}
+
+//    ȣ -  ӵ     ͸ ϰ   ĭ 
+void ProfilerBeginFrame() {
+    if (profiler.queries[0][0] == 0) return;
+
+    for (int f = 0; f < PROFILE_FRAMES_IN_FLIGHT; ++f) {
+        for (int i = 0; i < PROF_COUNT; ++i) {
+            if (!profiler.queryPending[f][i]) continue;
+            GLint available = 0;
+            glGetQueryObjectiv(profiler.queries[f][i], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) continue;
+            GLuint64 ns = 0;
+            glGetQueryObjectui64v(profiler.queries[f][i], GL_QUERY_RESULT, &ns);
+            profiler.gpu[i].Add(ns / 1000000.0f);
+            profiler.queryPending[f][i] = false;
+        }
+    }
+    profiler.frameSlot = (profiler.frameSlot + 1) % PROFILE_FRAMES_IN_FLIGHT;
+}
+
+//  ڿ HUD ؽƮ ߰ (BeginHudText ~ DrawHudText )
+void RenderProfilerOverlay() {
+    if (!profiler.overlayVisible) return;
+
+    auto now = std::chrono::steady_clock::now();
+    if (profiler.overlayLines.empty() || now - profiler.overlayUpdated > std::chrono::milliseconds(250)) {
+        profiler.overlayLines.clear();
+        profiler.overlayLines.push_back("SCOPE    CPU AVG  P99   GPU AVG  P99");
+        for (int i = 0; i < PROF_COUNT; ++i) {
+            float cAvg, cP99, gAvg, gP99;
+            profiler.cpu[i].Stats(cAvg, cP99);
+            profiler.gpu[i].Stats(gAvg, gP99);
+            char line[128];
+            if (profiler.gpu[i].count > 0) sprintf(line, "%-8s %6.2f %6.2f  %6.2f %6.2f", PROFILE_NAMES[i], cAvg, cP99, gAvg, gP99);
+            else sprintf(line, "%-8s %6.2f %6.2f       -      -", PROFILE_NAMES[i], cAvg, cP99);
+            profiler.overlayLines.push_back(line);
+        }
+        profiler.overlayUpdated = now;
+    }
+
+    float y = g_height - 140.0f;
+    for (const auto& line : profiler.overlayLines) {
+        RenderText(20, y, line.c_str(), 0.1f, 0.9f, 0.1f, 0.18f);
+        y -= 26.0f;
+    }
+}
+
+// --- Ʈ   ---
+//  model  /  / ؽó ÷׸ glUniform  UBO ڵ 
+// ۸ OBJECT_RING_FRAMES    (GL_ARB_buffer_storage) ΰ,
+// Ӹ    ڵ带 memcpy    -> ׸  glBindBufferRange ¸ 
+//  ٽ   潺 GPU  о Ȯ ( )
+//  ʴ ̹  ̾ƿ glBufferSubData ε
+// []  ü ũ OBJECT_RING_MAX_BYTES - ū  GPU ø( ڵ SSBO + MDI) ׸,
+// CPU  δ ü    ڵ  ׷ ġ  ׸ 
+const int OBJECT_RING_FRAMES = 3;
+const GLsizeiptr OBJECT_RING_MAX_BYTES = 32 * 1024 * 1024;
+const GLuint OBJECT_BLOCK_BINDING = 0;
+const GLuint OBJECT_STORAGE_BINDING = 1; // [߰] MultiDrawIndirect  (vertex.glsl binding = 1)
+
+// vertex.glsl / fragment.glsl ObjectData ϰ  std140 ̾ƿ
+struct ObjectRecord {
+    glm::mat4 model;
+    float color[4]; // rgb (+ ̻)
+    int flags[4];   // x: useVertexColor, y: useTexture, z: textureLayer, w: ̻
+};
+
+struct ObjectRing {
+    GLuint buffer = 0;
+    bool persistent = false;
+    unsigned char* mapped = NULL;
+    GLsizeiptr stride = 0;  // ڵ  (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT )
+    int capacity = 0;       //  ڵ 
+    int section = 0;        // ̹   
+    GLsync fences[OBJECT_RING_FRAMES] = { 0 };
+
+    long long fenceWaits = 0; // 潺 Ⱑ  ߻ Ƚ
+};
+ObjectRing objectRing;
+
+// [߰]  ִ ڵ  (64 , stride  ڿ ǹ )
+int ObjectRingMaxCapacity() {
+    GLsizeiptr stride = std::max<GLsizeiptr>(objectRing.stride, 1);
+    return (int)(OBJECT_RING_MAX_BYTES / (stride * OBJECT_RING_FRAMES) / 64 * 64);
+}
+
+//  ũ  - GPU  ۴  潺 ٸ  
+void CreateObjectRing(int capacity) {
+    if (objectRing.buffer) {
+        for (int i = 0; i < OBJECT_RING_FRAMES; ++i) {
+            if (!objectRing.fences[i]) continue;
+            glClientWaitSync(objectRing.fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(objectRing.fences[i]);
+            objectRing.fences[i] = 0;
+        }
+        glDeleteBuffers(1, &objectRing.buffer);
+    }
+
+    // [߰] SSBO     GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT  ʵ 64 
+    capacity = (capacity + 63) / 64 * 64;
+    objectRing.capacity = capacity;
+    GLsizeiptr size = objectRing.stride * capacity * OBJECT_RING_FRAMES;
+    glGenBuffers(1, &objectRing.buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, objectRing.buffer);
+    if (objectRing.persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_UNIFORM_BUFFER, size, NULL, flags);
+        objectRing.mapped = (unsigned char*)glMapBufferRange(GL_UNIFORM_BUFFER, 0, size, flags);
+    }
+    else {
+        glBufferData(GL_UNIFORM_BUFFER, size, NULL, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void InitObjectRing(bool storageBuffer) {
+    // SSBO 迭(std430) ڵ尡 ƴ پ ־ , UBO  ε   ʿ
+    GLint align = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align);
+    if (storageBuffer) align = 16;
+    objectRing.stride = ((sizeof(ObjectRecord) + align - 1) / align) * align;
+    objectRing.persistent = GLEW_ARB_buffer_storage || GLEW_VERSION_4_4;
+    CreateObjectRing(1024);
+
+    printf("[ObjectRing] %s, %s, record %d bytes (stride %d)\n", objectRing.persistent ? "persistent map" : "glBufferSubData",
+        storageBuffer ? "SSBO" : "UBO", (int)sizeof(ObjectRecord), (int)objectRing.stride);
+}
+
+// [߰] ׸⿡ ʿ     (  / ø ڵ )
+// ùķ̼   ٲ㵵  غ 尡 д  ״
+enum RenderList { RENDER_LIST_PLAYER, RENDER_LIST_LOBBY, RENDER_LIST_MAP, RENDER_LIST_COUNT };
+
+enum RenderObjectFlag {
+    RENDER_OBJECT_PLAYER = 1,        //  ȸ 
+    RENDER_OBJECT_STATIC_BATCH = 2,
+    RENDER_OBJECT_VERTEX_LAYERS = 4,
+    RENDER_OBJECT_OBSTACLE = 8,      // ̴ϸʿ 
+    RENDER_OBJECT_LOD = 16,          // cold LOD ܰ 
+};
+
+// 幰 д  - LOD ִ (÷̾ ) ׸  
+struct RenderObjectCold {
+    int lodLevels;
+    int lodFirst[MAX_SHAPE_LODS];
+    int lodVertexCount[MAX_SHAPE_LODS];
+    float lodRadius;
+    int list, index;       //   (RenderList) ġ - LOD ׸ý  Ű
+};
+
+// []  ü  ʵ庰 迭 (SoA) -  / ø   տ ȴ  ϰ
+//  ȣ  , ũ Resizeθ ٲ
+struct RenderObjectList {
+    std::vector<glm::vec3> position;
+    std::vector<glm::vec3> color;
+    std::vector<int> sceneFirst;       //     
+    std::vector<int> vertexCount;
+    std::vector<int> textureLayer;     //  ؽó ̾ (-1: ,  ۴  Ӽ)
+    std::vector<uint8_t> flags;        // RenderObjectFlag
+    std::vector<GLenum> primitiveType;
+    std::vector<RenderObjectCold> cold;
+
+    size_t size() const { return flags.size(); }
+    void Resize(size_t n) {
+        position.resize(n); color.resize(n); sceneFirst.resize(n); vertexCount.resize(n);
+        textureLayer.resize(n); flags.resize(n); primitiveType.resize(n); cold.resize(n);
+    }
+};
+
+// [߰] ڵ带   ؽó ε 
+struct TextureSnapshot {
+    uint32_t readyMask = 0; // ̾ textureLayerReady
+    bool complete = false;  //  ̾ ε Ϸ (  ؽó)
+};
+
+TextureSnapshot CurrentTextureState() {
+    TextureSnapshot t;
+    for (int i = 0; i < MAX_TEXTURE_LAYERS; ++i)
+        if (textureLayerReady[i]) t.readyMask |= 1u << i;
+    // [] ۾  ƴ϶  ۰  ̾  ö󰬴 Ǵ
+    // (ڵ  ̾    ۴   ׸)
+    uint32_t batchLayers = textureBatchLayers;
+    t.complete = batchLayers != 0 && (t.readyMask & batchLayers) == batchLayers;
+    return t;
+}
+
+//     slot°  - ؽó ̾ ⼭ 
+// [] ü ϳ  SoA Ͽ   (slot Resize ̸  )
+void WriteRenderObject(RenderObjectList& out, size_t slot, const Shape& s, bool isPlayer, int list, int index) {
+    bool player = isPlayer && s.shapeType == '1';
+    out.primitiveType[slot] = s.primitiveType;
+    out.vertexCount[slot] = s.vertexCount;
+    out.sceneFirst[slot] = std::max(s.mesh.first, 0);
+    out.position[slot] = glm::vec3(s.x, s.y, s.z);
+    out.color[slot] = glm::vec3(s.color[0], s.color[1], s.color[2]);
+    out.flags[slot] = (player ? RENDER_OBJECT_PLAYER : 0) | (s.isStaticBatch ? RENDER_OBJECT_STATIC_BATCH : 0)
+        | (s.hasVertexLayers ? RENDER_OBJECT_VERTEX_LAYERS : 0) | (s.isObstacle ? RENDER_OBJECT_OBSTACLE : 0)
+        | (s.lodLevels > 0 ? RENDER_OBJECT_LOD : 0);
+
+    RenderObjectCold& c = out.cold[slot];
+    c.lodLevels = s.lodLevels;
+    for (int i = 0; i < s.lodLevels; ++i) { c.lodFirst[i] = s.lodFirst[i]; c.lodVertexCount[i] = s.lodVertexCount[i]; }
+    c.lodRadius = s.lodRadius;
+    c.list = list;
+    c.index = index;
+
+    // --- [ؽó   ] ---
+    // [] ؽó 迭 drawScene   ε, ⼭ ̾ 
+    int layer = -1;
+
+    if (player) {
+        layer = rockTextureLayer;
+    }
+    else if (s.textureLayer >= 0) {
+        // [ٽ]    ؽó()  װ 
+        layer = s.textureLayer;
+    }
+    else if (s.isWall) {
+        layer = wallTextureLayer;
+    }
+    out.textureLayer[slot] = layer;
+}
+
+//    ڵ - model , , ؽó 
+// []      / ؽó  /  ȸ  ( غ 忡 ȣ)
+// [] SoA  i° - hot 迭 
+ObjectRecord MakeObjectRecord(const RenderObjectList& list, size_t i, const TextureSnapshot& tex, const glm::quat& orientation) {
+    ObjectRecord rec;
+    const glm::vec3& color = list.color[i];
+    rec.color[0] = color.x; rec.color[1] = color.y; rec.color[2] = color.z; rec.color[3] = 1.0f;
+
+    //  ۴  Ӽ ̾  (-1),  ̾ ö ڿ ؽó 
+    uint8_t flags = list.flags[i];
+    bool vertexLayers = (flags & RENDER_OBJECT_VERTEX_LAYERS) != 0;
+    int layer = list.textureLayer[i];
+    bool useTex = vertexLayers ? tex.complete : (layer >= 0 && (tex.readyMask & (1u << layer)));
+    rec.flags[0] = (flags & RENDER_OBJECT_STATIC_BATCH) ? 1 : 0;
+    rec.flags[1] = useTex ? 1 : 0;
+    rec.flags[2] = vertexLayers ? -1 : layer;
+    rec.flags[3] = 0;
+
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), list.position[i]);
+    if (flags & RENDER_OBJECT_PLAYER) {
+        model = model * glm::mat4_cast(orientation);
+    }
+    rec.model = model;
+    return rec;
+}
+
+//  ڵ带 ̹     (׸    ȣ)
+// [] ڵ  غ 尡 PreparedFrame    ( objectRing.stride)
+void ObjectRingUpload(const std::vector<unsigned char>& staging, int count) {
+    if (count > objectRing.capacity) CreateObjectRing(std::min(std::max(count, objectRing.capacity * 2), ObjectRingMaxCapacity()));
+
+    GLsync& fence = objectRing.fences[objectRing.section];
+    if (fence) {
+        // ̹  ٷ , ƴϸ GPU      
+        if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+            objectRing.fenceWaits++;
+            while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) {}
+        }
+        glDeleteSync(fence);
+        fence = 0;
+    }
+
+    GLsizeiptr base = objectRing.stride * objectRing.capacity * objectRing.section;
+    GLsizeiptr bytes = objectRing.stride * count;
+    if (bytes == 0) return;
+    if (objectRing.persistent) {
+        memcpy(objectRing.mapped + base, staging.data(), bytes);
+    }
+    else {
+        glBindBuffer(GL_UNIFORM_BUFFER, objectRing.buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, base, bytes, staging.data());
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+}
+
+void BindObjectRecord(int index) {
+    GLintptr offset = objectRing.stride * (objectRing.capacity * objectRing.section + index);
+    glBindBufferRange(GL_UNIFORM_BUFFER, OBJECT_BLOCK_BINDING, objectRing.buffer, offset, sizeof(ObjectRecord));
+}
+
+// [߰] ̹  ø ڵ  ĸ ٽ  ( ÷̾ ġ)
+void ObjectRingWriteModel(int index, const glm::mat4& model) {
+    GLintptr offset = objectRing.stride * (objectRing.capacity * objectRing.section + index);
+    if (objectRing.persistent) {
+        memcpy(objectRing.mapped + offset, &model, sizeof(glm::mat4));
+    }
+    else {
+        glBindBuffer(GL_UNIFORM_BUFFER, objectRing.buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, offset, sizeof(glm::mat4), &model);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+}
+
+// [߰] ̹  ü SSBO ε (MultiDrawIndirect - ڵ ȣ  ̴ baseInstance )
+void BindObjectStorage() {
+    GLintptr base = objectRing.stride * objectRing.capacity * objectRing.section;
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, OBJECT_STORAGE_BINDING, objectRing.buffer, base, objectRing.stride * objectRing.capacity);
+}
+
+// ̹  д  ׸ ڿ 潺 ΰ  
+void ObjectRingEndFrame() {
+    objectRing.fences[objectRing.section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    objectRing.section = (objectRing.section + 1) % OBJECT_RING_FRAMES;
+}
+
+// ---    (MultiDrawIndirect) ---
+//  (shapes, lobbyShapes, mapShapes)  ͸  ϳ  ΰ,
+// н DrawArraysIndirectCommand 迭  glMultiDrawArraysIndirect   ׸
+//  baseInstance = ڵ ȣ -> νϽ Ӽ(location 5)  ̴ , SSBO  ͸ 
+// GL 4.3 ̸̰ų --no-mdi  glDrawArrays (UBO ڵ)  
+// []  ε  ۿ   ׸ ( VAO  )
+// []   ޽ Ʒ  ϳ - ó   ø,  ٲ   ø
+const int SCENE_VERTEX_FLOATS = 12; // ġ 3,  3,  3, UV 2, ̾ 1
+
+struct DrawArraysIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+};
+
+// --- ޽ Ʒ ---
+// [߰]    -   (SceneGeometry.VBO) Ʒ    
+//   ȸ vertices/normals/colors/uvs/layers  (FlipHorizontalUVs,    ⼭ )
+// ó SceneGeometrySet   ͸ ε ⿭ ְ CPU 纻  ->  Shape Mesh ڵ鸸 
+// []       ϳ   ,    ° ȯ (ReleaseRunData)
+// ÷̾ / κ  α׷   ״
+//   SceneGeometrySet( )  ȣ  ־   ׸     Ƿ
+// ȯ  GL 尡   ׸  ڿ ٽ  (meshArena.drawnVersion)
+//  ũ ̻ ȯ     ù  (  ߰)
+int AllocateMeshRange(int count) {
+    int drawn = meshArena.drawnVersion;
+    for (size_t i = 0; i < meshArena.freeRanges.size(); ++i) {
+        MeshRange& r = meshArena.freeRanges[i];
+        if (r.count < count || r.freedVersion > drawn) continue;
+        int first = r.first;
+        r.first += count; r.count -= count;
+        if (r.count == 0) meshArena.freeRanges.erase(meshArena.freeRanges.begin() + i);
+        return first;
+    }
+    int first = meshArena.top;
+    meshArena.top += count;
+    return first;
+}
+
+// [] ̹     Ѳ ȯ (   -  Ƚŭ,   )
+void ReleaseRunMeshes() {
+    //      Ű  (GPU  ٷ )
+    int freedVersion = meshArena.gpu ? meshArena.publishedVersion + 1 : 0;
+    for (const MeshRange& r : meshArena.runRanges) {
+        meshArena.freeRanges.push_back({ r.first, r.count, freedVersion });
+        meshArena.liveVertices -= r.count;
+    }
+    meshArena.runRanges.clear();
+}
+
+//   CPU  ͸ (GL ȣ  - ۾ 忡  ȣ)
+// []        out ġ ٷ 
+void InterleaveShape(const Shape& s, float* out, glm::vec3& lo, glm::vec3& hi) {
+    lo = glm::vec3(1e30f); hi = glm::vec3(-1e30f);
+    bool hasColors = s.colors.size() >= (size_t)s.vertexCount * 3;
+    bool hasNormals = s.normals.size() >= (size_t)s.vertexCount * 3;
+    bool hasUVs = s.uvs.size() >= (size_t)s.vertexCount * 2;
+    bool hasLayers = s.layers.size() >= (size_t)s.vertexCount;
+    float* v = out;
+    for (int i = 0; i < s.vertexCount; ++i, v += SCENE_VERTEX_FLOATS) {
+        v[0] = s.vertices[i * 3]; v[1] = s.vertices[i * 3 + 1]; v[2] = s.vertices[i * 3 + 2];
+        if (hasNormals) { v[3] = s.normals[i * 3]; v[4] = s.normals[i * 3 + 1]; v[5] = s.normals[i * 3 + 2]; }
+        else { v[3] = 0.0f; v[4] = 1.0f; v[5] = 0.0f; }
+        if (hasColors) { v[6] = s.colors[i * 3]; v[7] = s.colors[i * 3 + 1]; v[8] = s.colors[i * 3 + 2]; }
+        else { v[6] = s.color[0]; v[7] = s.color[1]; v[8] = s.color[2]; }
+        if (hasUVs) { v[9] = s.uvs[i * 2]; v[10] = s.uvs[i * 2 + 1]; }
+        else { v[9] = 0.0f; v[10] = 0.0f; }
+        v[11] = hasLayers ? s.layers[i] : 0.0f;
+        glm::vec3 p(v[0], v[1], v[2]);
+        lo = glm::min(lo, p); hi = glm::max(hi, p);
+    }
+}
+
+// ޽   Ʒ  (ùķ̼ ) - ͸ ۾ ٷ,  Ҵ 
+// [] run̸ ( ) ü   ϳ  runRanges  -  Ҵ / ȯ 
+void CommitShapeMeshes(const std::vector<Shape*>& pending, bool run) {
+    if (pending.empty()) return;
+    std::vector<int> offset(pending.size() + 1, 0); //     ġ
+    for (size_t k = 0; k < pending.size(); ++k) offset[k + 1] = offset[k] + pending[k]->vertexCount;
+    int total = offset.back();
+
+    std::vector<float> data((size_t)total * SCENE_VERTEX_FLOATS);
+    std::vector<glm::vec3> lo(pending.size()), hi(pending.size());
+    ParallelFor(0, (int)pending.size(), 32, [&](int first, int last) {
+        for (int k = first; k < last; ++k) InterleaveShape(*pending[k], data.data() + (size_t)offset[k] * SCENE_VERTEX_FLOATS, lo[k], hi[k]);
+    });
+
+    int base = 0;
+    if (run) {
+        base = AllocateMeshRange(total);
+        meshArena.runRanges.push_back({ base, total, 0 });
+        meshArena.freeRanges.reserve(meshArena.freeRanges.size() + meshArena.runRanges.size()); // [߰]   Ҵ 
+    }
+    meshArena.liveVertices += total;
+
+    std::vector<MeshUpload> uploads;
+    for (size_t k = 0; k < pending.size(); ++k) {
+        Shape& s = *pending[k];
+        Mesh& m = s.mesh;
+        m.vertexCount = s.vertexCount;
+        m.first = run ? base + offset[k] : AllocateMeshRange(s.vertexCount);
+        m.boundsMin = lo[k]; m.boundsMax = hi[k];
+        if (!run && meshArena.gpu && s.vertexCount > 0) {
+            const float* src = data.data() + (size_t)offset[k] * SCENE_VERTEX_FLOATS;
+            uploads.push_back({ m.first, std::vector<float>(src, src + (size_t)s.vertexCount * SCENE_VERTEX_FLOATS) });
+        }
+
+        // CPU 纻  - capacity 
+        std::vector<float>().swap(s.vertices);
+        std::vector<float>().swap(s.normals);
+        std::vector<float>().swap(s.colors);
+        std::vector<float>().swap(s.uvs);
+        std::vector<float>().swap(s.layers);
+    }
+    if (run && meshArena.gpu && total > 0) uploads.push_back({ base, std::move(data) });
+    if (uploads.empty()) return;
+    std::lock_guard<std::mutex> lock(meshArena.uploadMutex);
+    for (MeshUpload& u : uploads) meshArena.uploads.push_back(std::move(u));
+}
+
+// [߰]        ( ڷδ ٲ  -   shared_ptr )
+// []  ޽ Ʒ  - ⿡  ׸/ø Է¸
+struct SceneGeometrySet {
+    int version = 0;
+    RenderObjectList mapObjects;           //   (ġ ) - CPU  / ø Է
+    std::vector<glm::vec3> mapBoundsMin, mapBoundsMax; //    AABB
+};
+
+struct SceneGeometry {
+    bool multiDraw = false;   // н   glMultiDrawArraysIndirect 
+    GLuint VAO = 0, VBO = 0;
+    std::shared_ptr<const SceneGeometrySet> uploaded; // [߰]  ׸ 
+    GLuint drawIdBuffer = 0;  // 0, 1, 2 ... (νϽ Ӽ - baseInstance  ڵ ȣ)
+    GLuint indirectBuffer = 0;
+    int vertexCapacity = 0;   // [] VBO ũ ( ) - Ʒ ġ  
+    int drawIdCount = 0;
+};
+SceneGeometry sceneGeometry;
+bool multiDrawRequested = true; // --no-mdi  (񱳿)
+
+//  Ӽ 0~4  VBO  (VBO Ű ڿ ȣ)
+void BindSceneVertexFormat() {
+    glBindVertexArray(sceneGeometry.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, sceneGeometry.VBO);
+    GLsizei stride = SCENE_VERTEX_FLOATS * sizeof(float);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)(0 * sizeof(float))); glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float))); glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, (void*)(6 * sizeof(float))); glEnableVertexAttribArray(2);
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, stride, (void*)(9 * sizeof(float))); glEnableVertexAttribArray(3);
+    glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, stride, (void*)(11 * sizeof(float))); glEnableVertexAttribArray(4);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void InitSceneGeometry() {
+    glGenVertexArrays(1, &sceneGeometry.VAO);
+    glGenBuffers(1, &sceneGeometry.VBO);
+    glGenBuffers(1, &sceneGeometry.drawIdBuffer);
+    glGenBuffers(1, &sceneGeometry.indirectBuffer);
+    meshArena.gpu = true;
+
+    BindSceneVertexFormat();
+    glBindVertexArray(sceneGeometry.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, sceneGeometry.drawIdBuffer);
+    glVertexAttribIPointer(5, 1, GL_UNSIGNED_INT, 0, 0);
+    glVertexAttribDivisor(5, 1);
+    glEnableVertexAttribArray(5);
+    glBindVertexArray(0);
+}
+
+//   ٲ  ( /)   - GL ȣ , ùķ̼ ʿ ȣ
+// []    ޽ Ʒ ϰ,   ׸ / ø Է 
+std::shared_ptr<const SceneGeometrySet> BuildSceneGeometrySet(int version) {
+    std::shared_ptr<SceneGeometrySet> set = std::make_shared<SceneGeometrySet>();
+    set->version = version;
+
+    // [] ÷̾ / κ  ,     ϳ
+    std::vector<Shape*> pending;
+    for (ShapeList* list : { &shapes, &lobbyShapes })
+        for (auto& s : *list) if (s.mesh.first < 0) pending.push_back(&s);
+    CommitShapeMeshes(pending, false);
+    pending.clear();
+    for (auto& s : mapShapes) if (s.mesh.first < 0) pending.push_back(&s);
+    CommitShapeMeshes(pending, true);
+    meshArena.publishedVersion = version;
+
+    //    Ƿ   ʰ ⿡  
+    set->mapObjects.Resize(mapShapes.size());
+    set->mapBoundsMin.resize(mapShapes.size());
+    set->mapBoundsMax.resize(mapShapes.size());
+    ParallelFor(0, (int)mapShapes.size(), 64, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            const Shape& s = mapShapes[i];
+            glm::vec3 pos(s.x, s.y, s.z);
+            WriteRenderObject(set->mapObjects, i, s, false, RENDER_LIST_MAP, i);
+            set->mapBoundsMin[i] = s.mesh.boundsMin + pos;
+            set->mapBoundsMax[i] = s.mesh.boundsMax + pos;
+        }
+    });
+    return set;
+}
+
+//   ޽ Ʒ  ø CPU 纻  (GL ,   -  ٷ ȯ)
+void UploadPendingMeshes() {
+    std::vector<MeshUpload> uploads;
+    {
+        std::lock_guard<std::mutex> lock(meshArena.uploadMutex);
+        if (meshArena.uploads.empty()) return;
+        uploads.swap(meshArena.uploads);
+    }
+
+    int needed = 0;
+    for (const MeshUpload& u : uploads) needed = std::max(needed, u.first + (int)(u.vertices.size() / SCENE_VERTEX_FLOATS));
+    GLsizeiptr vertexBytes = SCENE_VERTEX_FLOATS * sizeof(float);
+    if (needed > sceneGeometry.vertexCapacity) {
+        //   Ű ̹ ö  GPU 
+        int capacity = std::max(needed, sceneGeometry.vertexCapacity * 2);
+        GLuint grown;
+        glGenBuffers(1, &grown);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, grown);
+        glBufferData(GL_COPY_WRITE_BUFFER, capacity * vertexBytes, NULL, GL_STATIC_DRAW);
+        if (sceneGeometry.vertexCapacity > 0) {
+            glBindBuffer(GL_COPY_READ_BUFFER, sceneGeometry.VBO);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, sceneGeometry.vertexCapacity * vertexBytes);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        glDeleteBuffers(1, &sceneGeometry.VBO);
+        sceneGeometry.VBO = grown;
+        sceneGeometry.vertexCapacity = capacity;
+        BindSceneVertexFormat();
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, sceneGeometry.VBO);
+    for (const MeshUpload& u : uploads) {
+        glBufferSubData(GL_ARRAY_BUFFER, u.first * vertexBytes, u.vertices.size() * sizeof(float), u.vertices.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// ڵ ȣ νϽ Ӽ  -    / ø  ڵ  ū ʸŭ
+void UpdateDrawIds(int needed) {
+    if (sceneGeometry.drawIdCount >= needed) return;
+    std::vector<GLuint> ids(needed);
+    for (int i = 0; i < needed; ++i) ids[i] = i;
+    glBindBuffer(GL_ARRAY_BUFFER, sceneGeometry.drawIdBuffer);
+    glBufferData(GL_ARRAY_BUFFER, ids.size() * sizeof(GLuint), ids.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    sceneGeometry.drawIdCount = needed;
+}
+
+// ̹  ( + ̴ϸ)  ۿ   ø (۸  Ҵ  Ӱ ġ ʰ)
+void UploadIndirectCommands(const std::vector<DrawArraysIndirectCommand>& cmds) {
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, sceneGeometry.indirectBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, cmds.size() * sizeof(DrawArraysIndirectCommand), cmds.empty() ? NULL : cmds.data(), GL_STREAM_DRAW);
+}
+
+// --- ̴  (permutation) ---
+// vertex.glsl / fragment.glsl #define   α׷  Ʈ ĳ
+//    ׸ -> ׸Ʈ useTexture б  uniform  
+enum ShaderFeature {
+    SHADER_TEXTURED = 1,     // ؽó 迭 ø (TEXTURED)
+    SHADER_VERTEX_COLOR = 2, //   -    (VERTEX_COLOR)
+    SHADER_MULTIDRAW = 4,    //  ׸ + SSBO ڵ, νϽ Ӽ ڵ ȣ (OBJECT_SSBO, #version 430)
+};
+const int SHADER_VARIANT_COUNT = 8;
+const int DRAW_VARIANTS = 4; //  ޶ Ʈ (TEXTURED | VERTEX_COLOR) - ׸  
+
+struct ShaderVariant {
+    GLuint program = 0;
+    bool requested = false; // [߰]  
+    bool ready = false;     // [߰] ũ  uniform ġ ĳõ
+    GLint viewLoc = -1, projLoc = -1;
+    GLint lightPosLoc = -1, viewPosLoc = -1, lightColorLoc = -1;
+    GLint layerScaleLoc = -1; // [߰] ؽó  (̾ UV )
+};
+ShaderVariant shaderVariants[SHADER_VARIANT_COUNT];
+
+// ڵ ÷׷   (ؽó   󺸴 켱 -  б  )
+int DrawVariant(const ObjectRecord& rec) {
+    if (rec.flags[1]) return SHADER_TEXTURED;
+    if (rec.flags[0]) return SHADER_VERTEX_COLOR;
+    return 0;
+}
+
+ShaderVariant& GetShaderVariant(int features) {
+    return shaderVariants[features];
+}
+
+void OnShaderVariantReady(int features, GLuint program, bool ok);
+
+//  û ( ) - ũ  uniform ġ ĳϰ ready
+void RequestShaderVariant(int features) {
+    ShaderVariant& v = shaderVariants[features];
+    if (v.requested) return;
+    v.requested = true;
+
+    make_shaderProgram(features, [features](GLuint program, bool ok) { OnShaderVariantReady(features, program, ok); });
+}
+
+// ĳ  make_shaderProgram ƿ  ҸǷ α׷ ڷ 
+void OnShaderVariantReady(int features, GLuint program, bool ok) {
+    if (!ok) {
+        char name[32];
+        sprintf(name, "scene_%d", features);
+        FailRequiredProgram(name);
+    }
+    ShaderVariant& v = shaderVariants[features];
+    v.program = program;
+    v.viewLoc = glGetUniformLocation(v.program, "view");
+    v.projLoc = glGetUniformLocation(v.program, "projection");
+    v.lightPosLoc = glGetUniformLocation(v.program, "lightPos");
+    v.viewPosLoc = glGetUniformLocation(v.program, "viewPos");
+    v.lightColorLoc = glGetUniformLocation(v.program, "lightColor");
+    v.layerScaleLoc = glGetUniformLocation(v.program, "layerScale");
+
+    glUseProgram(v.program);
+    glUniform1i(glGetUniformLocation(v.program, "texture1"), 0); // ؽó  0 (ؽó 迭)
+    if (!(features & SHADER_MULTIDRAW)) {
+        GLuint blockIndex = glGetUniformBlockIndex(v.program, "ObjectData");
+        glUniformBlockBinding(v.program, blockIndex, OBJECT_BLOCK_BINDING);
+    }
+    glUseProgram(0);
+    v.ready = ok;
+}
+
+// [߰] κ ׸  ִ - ׸  ο HUD ؽƮ (ø ̴ غ  CPU  ü)
+bool SceneProgramsReady() {
+    for (int v = 0; v < DRAW_VARIANTS; ++v)
+        if (!GetShaderVariant(v | (sceneGeometry.multiDraw ? SHADER_MULTIDRAW : 0)).ready) return false;
+    return hudText.ready;
+}
+
+// --- GPU ø (ǻƮ ̴) ---
+//  (mapShapes)  Ƿ AABB ڵ带 GPU   ÷ ΰ,
+//   cull_compute.glsl н ü ˻  Ƴ    
+// -> Ÿ  CPU //  (н  ׸   ߰)
+//  GL_ARB_indirect_parameters  ī ۿ ٷ а,
+//   ۸ 0   ִ  ׸ (instanceCount 0  ǳʶ)
+const int CULL_GROUP_SIZE = 64;  // cull_compute.glsl local_size_x
+const int CULL_PASSES = 2;       // 0: , 1: ̴ϸ
+const int CULL_GROUPS = DRAW_VARIANTS; // [߰] ̴    ī͸  
+
+struct CullObject {
+    float boundsMin[4]; // w: ̴ϸ  (isObstacle)
+    float boundsMax[4]; // w: ̴   ȣ
+    GLuint draw[4];     //  ,   , ڵ ȣ,   ġ
+};
+
+struct GpuCulling {
+    std::atomic<bool> enabled{ false }; // []  غ 嵵  (  CPU )
+    bool indirectCount = false;  // glMultiDrawArraysIndirectCount  
+    GLuint program = 0;
+    GLuint objectBuffer = 0;     // CullObject 迭
+    GLuint recordBuffer = 0;     //   ObjectRecord ()
+    GLuint commandBuffer = 0;    // н objectCount (ȿ   )
+    GLuint counterBuffer = 0;    // н x  uvec2
+    GLuint readbackBuffer = 0;   //  ī 纻 (  ,  )
+    GLuint* readback = NULL;
+    int objectCount = 0;
+    int textureState = -1;       // ڵ带   textureJobsInFlight (ؽó ö ٽ )
+    int geometryVersion = -1;    // [߰] ڵ带  SceneGeometrySet 
+    int groupStart[CULL_GROUPS] = { 0 }; //   Է /  
+    int groupCount[CULL_GROUPS] = { 0 };
+
+    GLuint visibleObjects[CULL_PASSES][CULL_GROUPS] = { { 0 } }; // OBJECT_RING_FRAMES   
+    GLuint visibleVertices[CULL_PASSES][CULL_GROUPS] = { { 0 } };
+};
+GpuCulling gpuCulling;
+bool gpuCullingRequested = true; // --no-gpu-cull  (񱳿)
+
+GLuint make_cullProgram(ProgramReadyFn onReady);
+
+// [] ø ̴ ũ  enabled -      CPU 
+void InitGpuCulling() {
+    make_cullProgram([](GLuint program, bool ok) {
+        gpuCulling.program = program;
+        if (!ok) printf("[GpuCulling] cull_compute.glsl failed to build, using CPU collection\n");
+        gpuCulling.enabled = ok;
+    });
+    gpuCulling.indirectCount = GLEW_ARB_indirect_parameters || GLEW_VERSION_4_6;
+
+    glGenBuffers(1, &gpuCulling.objectBuffer);
+    glGenBuffers(1, &gpuCulling.recordBuffer);
+    glGenBuffers(1, &gpuCulling.commandBuffer);
+    glGenBuffers(1, &gpuCulling.counterBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, gpuCulling.counterBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, CULL_PASSES * CULL_GROUPS * 2 * sizeof(GLuint), NULL, GL_DYNAMIC_DRAW);
+
+    if (objectRing.persistent) {
+        GLsizeiptr size = OBJECT_RING_FRAMES * CULL_PASSES * CULL_GROUPS * 2 * sizeof(GLuint);
+        GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glGenBuffers(1, &gpuCulling.readbackBuffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, gpuCulling.readbackBuffer);
+        glBufferStorage(GL_COPY_WRITE_BUFFER, size, NULL, flags);
+        gpuCulling.readback = (GLuint*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    printf("[GpuCulling] Compute culling enabled (%s)\n", gpuCulling.indirectCount ? "IndirectCount" : "zero-filled commands");
+}
+
+//   AABB / ڵ带 ٽ ø (  ۸ ٽ ø , Ǵ ؽó ö )
+// []     ö ִ SceneGeometrySet 
+void RebuildCullData(const SceneGeometrySet& set) {
+    const RenderObjectList& map = set.mapObjects;
+    std::vector<CullObject> objects;
+    std::vector<ObjectRecord> records;
+    objects.reserve(map.size());
+    records.reserve(map.size());
+
+    // [߰] ̴   -  Է°   
+    TextureSnapshot tex = CurrentTextureState();
+    glm::quat noRotation(1.0f, 0.0f, 0.0f, 0.0f);
+    std::vector<int> variants(map.size());
+    std::vector<size_t> order(map.size());
+    for (size_t i = 0; i < map.size(); ++i) {
+        variants[i] = DrawVariant(MakeObjectRecord(map, i, tex, noRotation));
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return variants[a] < variants[b]; });
+    for (int g = 0; g < CULL_GROUPS; ++g) gpuCulling.groupCount[g] = 0;
+    for (size_t i = 0; i < map.size(); ++i) gpuCulling.groupCount[variants[i]]++;
+    for (int g = 0, start = 0; g < CULL_GROUPS; ++g) { gpuCulling.groupStart[g] = start; start += gpuCulling.groupCount[g]; }
+
+    for (size_t idx : order) {
+        int group = variants[idx];
+        const glm::vec3& lo = set.mapBoundsMin[idx];
+        const glm::vec3& hi = set.mapBoundsMax[idx];
+        CullObject c = { { lo.x, lo.y, lo.z, (map.flags[idx] & RENDER_OBJECT_OBSTACLE) ? 1.0f : 0.0f },
+                         { hi.x, hi.y, hi.z, (float)group },
+                         { (GLuint)map.vertexCount[idx], (GLuint)map.sceneFirst[idx], (GLuint)records.size(), (GLuint)gpuCulling.groupStart[group] } };
+        objects.push_back(c);
+        records.push_back(MakeObjectRecord(map, idx, tex, noRotation));
+    }
+
+    gpuCulling.objectCount = objects.size();
+    gpuCulling.textureState = textureJobsInFlight;
+    gpuCulling.geometryVersion = set.version;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, gpuCulling.objectBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, objects.size() * sizeof(CullObject), objects.empty() ? NULL : objects.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, gpuCulling.recordBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, records.size() * sizeof(ObjectRecord), records.empty() ? NULL : records.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, gpuCulling.commandBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, CULL_PASSES * std::max(1, gpuCulling.objectCount) * sizeof(DrawArraysIndirectCommand), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+//    ü   (Gribb-Hartmann) -  ̸ ڽ 
+void ExtractFrustumPlanes(const glm::mat4& m, glm::vec4 planes[6]) {
+    glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+    planes[0] = row3 + row0; planes[1] = row3 - row0;
+    planes[2] = row3 + row1; planes[3] = row3 - row1;
+    planes[4] = row3 + row2; planes[5] = row3 - row2;
+}
+
+// [߰] AABB  ϳ  ٱ̸ false (cull_compute.glsl  )
+bool AabbInFrustum(const glm::vec4 planes[6], const glm::vec3& lo, const glm::vec3& hi) {
+    glm::vec3 center = (lo + hi) * 0.5f;
+    glm::vec3 extent = (hi - lo) * 0.5f;
+    for (int p = 0; p < 6; ++p) {
+        const glm::vec4& n = planes[p];
+        float d = n.x * center.x + n.y * center.y + n.z * center.z + n.w;
+        float r = extent.x * fabsf(n.x) + extent.y * fabsf(n.y) + extent.z * fabsf(n.z);
+        if (d + r < 0.0f) return false;
+    }
+    return true;
+}
+
+// н ø ġ - viewProj[i] NULL̸  н ǳʶ
+void DispatchGpuCulling(const glm::mat4* viewProj[CULL_PASSES]) {
+    //    潺 ObjectRingUpload ̹ ٷǷ 3  ī͸ о 
+    if (gpuCulling.readback) {
+        GLuint* prev = gpuCulling.readback + objectRing.section * CULL_PASSES * CULL_GROUPS * 2;
+        for (int p = 0; p < CULL_PASSES; ++p) {
+            for (int g = 0; g < CULL_GROUPS; ++g) {
+                gpuCulling.visibleObjects[p][g] = prev[(p * CULL_GROUPS + g) * 2];
+                gpuCulling.visibleVertices[p][g] = prev[(p * CULL_GROUPS + g) * 2 + 1];
+            }
+        }
+    }
+
+    GLuint zero[CULL_PASSES * CULL_GROUPS * 2] = { 0 };
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, gpuCulling.counterBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(zero), zero);
+    if (!gpuCulling.indirectCount) {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, gpuCulling.commandBuffer);
+        glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
+    }
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    glUseProgram(gpuCulling.program);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, gpuCulling.objectBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, gpuCulling.commandBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, gpuCulling.counterBuffer);
+    glUniform1ui(glGetUniformLocation(gpuCulling.program, "objectCount"), gpuCulling.objectCount);
+
+    GLuint groups = (gpuCulling.objectCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE;
+    for (int p = 0; p < CULL_PASSES; ++p) {
+        if (!viewProj[p] || groups == 0) continue;
+        glm::vec4 planes[6];
+        ExtractFrustumPlanes(*viewProj[p], planes);
+        glUniform4fv(glGetUniformLocation(gpuCulling.program, "frustumPlanes"), 6, &planes[0][0]);
+        glUniform1ui(glGetUniformLocation(gpuCulling.program, "passIndex"), p);
+        glUniform1ui(glGetUniformLocation(gpuCulling.program, "commandBase"), p * gpuCulling.objectCount);
+        glUniform1i(glGetUniformLocation(gpuCulling.program, "skipObstacles"), p == 1 ? 1 : 0);
+        glDispatchCompute(groups, 1, 1);
+    }
+    // [] ī͸ б ۷ (glCopyBufferSubData)ϱ  ̴ Ⱑ ̵ BUFFER_UPDATE 
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    if (gpuCulling.readback) {
+        glBindBuffer(GL_COPY_READ_BUFFER, gpuCulling.counterBuffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, gpuCulling.readbackBuffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, objectRing.section * sizeof(zero), sizeof(zero));
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+}
+
+// ø    ׸ (  ϳ) - ڵ  ۿ  (׸    ٽ ε)
+void DrawGpuCulled(int pass, int group) {
+    int count = gpuCulling.groupCount[group];
+    if (count == 0) return;
+    glBindVertexArray(sceneGeometry.VAO);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, OBJECT_STORAGE_BINDING, gpuCulling.recordBuffer);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, gpuCulling.commandBuffer);
+    const void* offset = (const void*)((pass * gpuCulling.objectCount + gpuCulling.groupStart[group]) * sizeof(DrawArraysIndirectCommand));
+    if (gpuCulling.indirectCount) {
+        glBindBuffer(GL_PARAMETER_BUFFER_ARB, gpuCulling.counterBuffer);
+        glMultiDrawArraysIndirectCountARB(GL_TRIANGLES, offset, (pass * CULL_GROUPS + group) * 2 * sizeof(GLuint), count, 0);
+    }
+    else {
+        glMultiDrawArraysIndirect(GL_TRIANGLES, offset, count, 0);
+    }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, sceneGeometry.indirectBuffer);
+    BindObjectStorage();
+
+    renderStats.drawCalls++;
+    renderStats.triangles += gpuCulling.visibleVertices[pass][group] / 3;
+}
+
+// ---   /  غ  ---
+// [߰] ׸Ⱑ rock, cameraPos, shapes, mapShapes, currentState   ʵ
+// ùķ̼ ƽ  ׸⿡ ʿ (ȯ, ̴ , ī޶, HUD ) RenderSnapshot  
+//  غ 尡  PreparedFrame(ڵ, н ׸ ,  )  GL  ø ⸸ 
+//  / غ     -  ʰ д   ٸ 
+// ׸     ӱ  (renderPrep.maxLag) ->  ƽ ׸  ۼ ħ
+// []   /   SceneGeometrySet  Ǹ -> Ӹ ڱ   ۷ ׸
+const int TRIPLE_FRESH = 4; // latest ٴ "  " Ʈ
+
+//  3  ȯ ְ (  1, ֽ 1, д  1)
+template <typename T>
+struct TripleBuffer {
+    T slots[3];
+    std::atomic<int> latest{ 1 };
+    int writeIndex = 0, readIndex = 2;
+
+    T& Write() { return slots[writeIndex]; }
+    void Publish() { writeIndex = latest.exchange(writeIndex | TRIPLE_FRESH) & 3; }
+    //     б ԰ ȯ
+    bool Acquire() {
+        if (!(latest.load() & TRIPLE_FRESH)) return false;
+        readIndex = latest.exchange(readIndex) & 3;
+        return true;
+    }
+    const T& Read() const { return slots[readIndex]; }
+};
+
+// [߰]  غ 尡 д â ũ (Reshape / --bench )
+std::atomic<int> viewWidth{ 1200 }, viewHeight{ 1200 };
+
+void SetViewSize(int w, int h) {
+    g_width = w; g_height = h;
+    viewWidth = w; viewHeight = std::max(1, h);
+}
+
+// [߰] ƽ   -  ƽ(from) ̹ ƽ(to), tickTime  ƽ  Ű  ׸ ( ƽ ʰ )
+struct TickPose {
+    glm::vec3 cameraPos, cameraTarget, playerPos;
+    glm::quat playerOrientation;
+};
+struct TickMotion {
+    TickPose from, to;
+    FrameClock::time_point tickTime;
+    bool active = false; //  ƽ ̾ ( ȯ / ̵̸ to ״)
+};
+
+struct RenderSnapshot {
+    long long sequence = 0;     //  ȣ (1)
+    GameState state = LOBBY;
+    glm::vec3 cameraPos, cameraTarget, cameraUp;
+    bool isPerspective = true;
+    float cameraYaw = 0.0f;
+    glm::vec3 playerPos;
+    glm::quat playerOrientation;
+    float towerMid = 0.0f, mapHalfWidth = 0.0f; // ̴ϸ 
+    float gameTime = 0.0f;
+    float tickMs = 0.0f;        //  ƽ ҿ ð (PHYSICS )
+    std::shared_ptr<const SceneGeometrySet> geometry;
+    RenderObjectList objects;   // ̴  - ÷̾, (κ) 
+    TickMotion motion;          // [߰]
+};
+
+// ׸   (ڵ ε   ġ )
+struct DrawItem {
+    GLenum primitiveType;
+    int first, count;
+    int record;
+    int sceneFirst; // [߰]      
+    int variant;    // [߰] ̴  (TEXTURED | VERTEX_COLOR)
+};
+
+struct PreparedFrame {
+    long long sequence = 0;     //   ȣ
+    GameState state = LOBBY;
+    glm::mat4 mainView, mainProj, miniView, miniProj;
+    glm::vec3 cameraPos, lightPos;
+    glm::vec3 cameraUp;         // [߰]  ī޶   ٽ  
+    TickMotion motion;          // [߰]
+    std::vector<int> playerRecords; // [߰] ÷̾ ڵ ȣ - ׸    ķ ٽ 
+    bool showMiniMap = false;
+    bool drawCulledMap = false; //   GPU ø ׸ (Ͽ )
+    float gameTime = 0.0f;
+    float tickMs = 0.0f;
+    std::shared_ptr<const SceneGeometrySet> geometry;
+
+    std::vector<unsigned char> records; //     ״  ڵ ( objectRing.stride)
+    int recordCount = 0;
+    int droppedRecords = 0;             // [߰]   ѵ Ѿ ׸   
+    std::vector<DrawItem> mainItems, miniItems;
+    std::vector<DrawItem> sortScratch; // [߰]   Ŀ (Ӹ )
+    std::vector<DrawArraysIndirectCommand> commands; // MultiDrawIndirect:   ̴ϸ
+    float prepMs = 0.0f;
+};
+
+struct LodState {
+    int current[2] = { 0, 0 }; // (0: , 1: ̴ϸ)  ܰ - ׸ý
+};
+
+struct RenderPrep {
+    TripleBuffer<RenderSnapshot> snapshots;
+    TripleBuffer<PreparedFrame> frames;
+    std::atomic<long long> publishCount{ 0 }; //    (GL    ִ )
+    int geometryVersion = 0;                  //   
+    TickMotion motion;                        // [߰]    -   
+    long long motionTick = -1;                //    simTick
+    GameState motionState = LOBBY;
+    std::shared_ptr<const SceneGeometrySet> geometry;
+
+    bool threaded = true;             // --no-render-thread   ٷ غ
+    int maxLag = 1;                   // ׸  ϴ   (--bench 0)
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;     //   
+    std::condition_variable done;     //  غ Ϸ
+    long long publishedSequence = 0;  // (mutex)
+    long long preparedSequence = 0;   // (mutex)
+    bool quit = false;                // (mutex)
+
+    std::vector<LodState> lodState[RENDER_LIST_COUNT]; // غ   - Ϻ,   LOD
+};
+RenderPrep renderPrep;
+
+// []   ѵ  -1 (׸ )
+int PushObjectRecord(PreparedFrame& f, const ObjectRecord& r) {
+    if (f.recordCount >= ObjectRingMaxCapacity()) {
+        f.droppedRecords++;
+        return -1;
+    }
+    size_t offset = f.recordCount * objectRing.stride;
+    if (f.records.size() < offset + objectRing.stride) f.records.resize(offset + objectRing.stride);
+    memcpy(&f.records[offset], &r, sizeof(ObjectRecord));
+    return f.recordCount++;
+}
+
+//  ϳ ׸  ۼ (GL ȣ  -  غ )
+void PrepareFrame(const RenderSnapshot& snap, PreparedFrame& f) {
+    FrameClock::time_point t0 = FrameClock::now();
+    int width = viewWidth, height = viewHeight;
+    bool mapVisible = (snap.state == PLAYING || snap.state == CLEAR);
+    f.sequence = snap.sequence;
+    f.state = snap.state;
+    f.cameraPos = snap.cameraPos;
+    f.cameraUp = snap.cameraUp;
+    f.motion = snap.motion;
+    f.lightPos = glm::vec3(snap.playerPos.x, snap.playerPos.y + 50.0f, snap.playerPos.z);
+    f.gameTime = snap.gameTime;
+    f.tickMs = snap.tickMs;
+    f.geometry = snap.geometry;
+    f.showMiniMap = mapVisible;
+    // [] GPU ø    ǻƮ ̴  
+    f.drawCulledMap = mapVisible && gpuCulling.enabled;
+    f.recordCount = 0;
+    f.droppedRecords = 0;
+    f.playerRecords.clear();
+    f.mainItems.clear();
+    f.miniItems.clear();
+    f.commands.clear();
+
+    f.mainView = glm::lookAt(snap.cameraPos, snap.cameraTarget, snap.cameraUp);
+    if (snap.isPerspective) f.mainProj = glm::perspective(glm::radians(60.0f), (float)width / height, 0.1f, 1000.0f);
+    else { float s = 40.0f; float a = (float)width / height; f.mainProj = glm::ortho(-s * a, s * a, -s, s, 0.1f, 1000.0f); }
+
+    // ̴ϸ (ȸ ) - ڵ带   ø   ̸ 
+    // [ٽ ] ī޶ ġ ÷̾ ȸ(cameraYaw) 缭 
+    float dist = 800.0f; // Ÿ ߽ɿ  Ÿ
+    float rad = glm::radians(snap.cameraYaw); //  ī޶  ()
+
+    // cos, sin ̿  ī޶ ġ 
+    // (cameraYaw  -90 ϹǷ ǥ迡 缭 sin/cos )
+    //  ī޶ İ ϰ 󰡵, ̴ Ÿ ߾  (⺻ : 250)
+    float camX = cos(rad) * dist;
+    float camZ = sin(rad) * dist;
+    glm::vec3 miniCamPos(camX, snap.towerMid, camZ);
+    glm::vec3 miniCamTarget(0.0f, snap.towerMid, 0.0f); // Ÿ 㸮 ٶ
+    f.miniView = glm::lookAt(miniCamPos, miniCamTarget, glm::vec3(0, 1, 0));
+
+    //  ü ̸ Ŀϴ 
+    // ⺻  ߽ 250, Ʒ 300 -> 0~550 Ŀ
+    float halfH = snap.towerMid + 50.0f;
+    f.miniProj = glm::ortho(-snap.mapHalfWidth, snap.mapHalfWidth, -halfH, halfH, 0.1f, 2000.0f);
+    int mapH = height / 2.5;
+
+    //   - н ׸    ʹ   ڵ
+    // []  glUniform ȣ  ObjectRecord  
+    TextureSnapshot textures = CurrentTextureState();
+    auto CollectPass = [&](const glm::mat4& viewMatrix, const glm::mat4& projMatrix, int viewportH, bool isMiniMap, std::vector<DrawItem>& items) {
+        glm::mat4 viewProj = projMatrix * viewMatrix; // [߰] LOD ÿ
+        glm::vec4 planes[6];
+        ExtractFrustumPlanes(viewProj, planes);
+
+        // [] SoA  ȣ   - LOD  cold 迭 
+        // [߰]  ڰ ( ) cull_compute.glsl   ü   ڵ带  
+        auto drawList = [&](const RenderObjectList& list, const SceneGeometrySet* bounds) {
+            size_t count = list.size();
+            items.reserve(items.size() + count);
+            for (size_t i = 0; i < count; ++i) {
+                uint8_t flags = list.flags[i];
+                if (isMiniMap && (flags & RENDER_OBJECT_OBSTACLE)) continue;
+                if (bounds && !AabbInFrustum(planes, bounds->mapBoundsMin[i], bounds->mapBoundsMax[i])) continue;
+
+                ObjectRecord rec = MakeObjectRecord(list, i, textures, snap.playerOrientation);
+
+                // [߰] LOD ִ  ȭ ũ⿡ ´ ܰ   ׸
+                DrawItem item = { list.primitiveType[i], 0, list.vertexCount[i], 0, list.sceneFirst[i], DrawVariant(rec) };
+                if (flags & RENDER_OBJECT_LOD) {
+                    const RenderObjectCold& c = list.cold[i];
+                    std::vector<LodState>& state = renderPrep.lodState[c.list];
+                    if ((int)state.size() <= c.index) state.resize(c.index + 1);
+                    float px = ProjectedRadius(viewProj, projMatrix, list.position[i], c.lodRadius, viewportH);
+                    int lod = SelectLod(c.lodLevels, state[c.index].current[isMiniMap ? 1 : 0], px);
+                    item.first = c.lodFirst[lod];
+                    item.count = c.lodVertexCount[lod];
+                }
+                item.record = PushObjectRecord(f, rec);
+                if (item.record < 0) continue;
+                if (flags & RENDER_OBJECT_PLAYER) f.playerRecords.push_back(item.record);
+                items.push_back(item);
+            }
+        };
+        drawList(snap.objects, NULL);
+        if (mapVisible && !f.drawCulledMap && snap.geometry) drawList(snap.geometry->mapObjects, snap.geometry.get());
+
+        // [߰] ̴   (  ȿ   )
+        // []  DRAW_VARIANTS̶      +   Ѹ ()
+        int start[DRAW_VARIANTS] = { 0 };
+        for (const DrawItem& item : items) start[item.variant]++;
+        for (int v = 0, next = 0; v < DRAW_VARIANTS; ++v) { int n = start[v]; start[v] = next; next += n; }
+        f.sortScratch.resize(items.size());
+        for (const DrawItem& item : items) f.sortScratch[start[item.variant]++] = item;
+        items.swap(f.sortScratch);
+        };
+
+    CollectPass(f.mainView, f.mainProj, height, false, f.mainItems);
+    if (f.showMiniMap) CollectPass(f.miniView, f.miniProj, mapH, true, f.miniItems);
+
+    // [߰] ׸    (  ̴ϸ)
+    if (sceneGeometry.multiDraw) {
+        for (const std::vector<DrawItem>* items : { &f.mainItems, &f.miniItems }) {
+            for (const DrawItem& item : *items) {
+                f.commands.push_back({ (GLuint)item.count, 1, (GLuint)(item.sceneFirst + item.first), (GLuint)item.record });
+            }
+        }
+    }
+    f.prepMs = std::chrono::duration<float, std::milli>(FrameClock::now() - t0).count();
+}
+
+//  ֱ   غ  
+void PrepareLatestFrame() {
+    if (!renderPrep.snapshots.Acquire()) return;
+    const RenderSnapshot& snap = renderPrep.snapshots.Read();
+    long long sequence = snap.sequence;
+    PrepareFrame(snap, renderPrep.frames.Write());
+    renderPrep.frames.Publish();
+
+    std::lock_guard<std::mutex> lock(renderPrep.mutex);
+    renderPrep.preparedSequence = std::max(renderPrep.preparedSequence, sequence);
+    renderPrep.done.notify_all();
+}
+
+void RenderPrepWorker() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(renderPrep.mutex);
+            renderPrep.wake.wait(lock, [] { return renderPrep.quit || renderPrep.publishedSequence > renderPrep.preparedSequence; });
+            if (renderPrep.quit) return;
+        }
+        PrepareLatestFrame();
+    }
+}
+
+void StopRenderPrep() {
+    if (!renderPrep.worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(renderPrep.mutex);
+        renderPrep.quit = true;
+    }
+    renderPrep.wake.notify_all();
+    renderPrep.worker.join();
+}
+
+void StartRenderPrep() {
+    if (!renderPrep.threaded) return;
+    renderPrep.worker = std::thread(RenderPrepWorker);
+    atexit(StopRenderPrep); // exit(0)  带   ( Ҹ )
+}
+
+// ùķ̼ ¸   (ƽ   ùķ̼ ʿ ȣ - GL ȣ )
+void PublishRenderSnapshot(float tickMs) {
+    //   ٲ   (  ⼭ ޽ Ʒ )
+    if (sceneShapesDirty || !renderPrep.geometry) {
+        renderPrep.geometry = BuildSceneGeometrySet(++renderPrep.geometryVersion);
+        sceneShapesDirty = false;
+    }
+
+    RenderSnapshot& snap = renderPrep.snapshots.Write();
+    long long sequence = renderPrep.publishCount + 1;
+    snap.sequence = sequence;
+    snap.state = currentState;
+    snap.cameraPos = cameraPos;
+    snap.cameraTarget = cameraTarget;
+    snap.cameraUp = cameraUp;
+    snap.isPerspective = isPerspective;
+    snap.cameraYaw = cameraYaw;
+    snap.playerPos = rock.position;
+    snap.playerOrientation = rock.orientation;
+    snap.towerMid = (GoalHeight() + 45.0f) / 2.0f;
+    snap.mapHalfWidth = std::max(mapConfig.width, mapConfig.depth) / 2.0f + 30.0f;
+    snap.gameTime = gameTime;
+    snap.tickMs = tickMs;
+    snap.geometry = renderPrep.geometry;
+
+    // [߰] ƽ    ̹ ƽ ű (ƽ  ٽ ϸ  )
+    TickMotion& motion = renderPrep.motion;
+    if (simTick != renderPrep.motionTick) {
+        TickPose pose = { cameraPos, cameraTarget, rock.position, rock.orientation };
+        motion.active = renderPrep.motionTick >= 0 && currentState == renderPrep.motionState
+            && glm::distance(pose.playerPos, motion.to.playerPos) < INTERP_MAX_STEP
+            && glm::distance(pose.cameraPos, motion.to.cameraPos) < INTERP_MAX_STEP;
+        motion.from = motion.to;
+        motion.to = pose;
+        motion.tickTime = FrameClock::now();
+        renderPrep.motionTick = simTick;
+        renderPrep.motionState = currentState;
+    }
+    snap.motion = motion;
+
+    // ̴   (  SceneGeometrySet)
+    bool lobbyVisible = (currentState == LOBBY || currentState == FALLING);
+    snap.objects.Resize(shapes.size() + (lobbyVisible ? lobbyShapes.size() : 0));
+    for (size_t i = 0; i < shapes.size(); ++i) WriteRenderObject(snap.objects, i, shapes[i], true, RENDER_LIST_PLAYER, i);
+    if (lobbyVisible) {
+        for (size_t i = 0; i < lobbyShapes.size(); ++i) WriteRenderObject(snap.objects, shapes.size() + i, lobbyShapes[i], false, RENDER_LIST_LOBBY, i);
+    }
+    renderPrep.snapshots.Publish();
+    renderPrep.publishCount = sequence;
+
+    if (!renderPrep.threaded) {
+        renderPrep.publishedSequence = sequence;
+        PrepareLatestFrame();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(renderPrep.mutex);
+        renderPrep.publishedSequence = sequence;
+    }
+    renderPrep.wake.notify_one();
+}
+
+// ׸  -   maxLag Ѱ ó غ  
+const PreparedFrame& AcquirePreparedFrame() {
+    // [] --no-sim-thread: GLUT idle display  θ -    ⼭ ù  
+    // (ùķ̼ 尡   尡 ù  ϹǷ ٸ⸸)
+    if (!simThread.threaded && renderPrep.publishCount == 0) PublishRenderSnapshot(0.0f);
+    {
+        std::unique_lock<std::mutex> lock(renderPrep.mutex);
+        long long need = std::max(renderPrep.publishedSequence - renderPrep.maxLag, 1LL);
+        renderPrep.done.wait(lock, [need] { return renderPrep.preparedSequence >= need; });
+    }
+    if (renderPrep.frames.Acquire()) {
+        const PreparedFrame& f = renderPrep.frames.Read();
+        profiler.cpu[PROF_PREP].Add(f.prepMs);
+        if (f.tickMs > 0.0f) profiler.cpu[PROF_PHYSICS].Add(f.tickMs);
+    }
+    return renderPrep.frames.Read();
+}
+
+void FlipHorizontalUVs(Shape* s) {
+    if (s == NULL) return;
+
+    // UV ǥ { u, v, u, v ... }  
+    // ¦ ε(0, 2, 4...) u ǥ Ŵ (1.0 - u)
+    for (size_t i = 0; i < s->uvs.size(); i += 2) {
+        s->uvs[i] = 1.0f - s->uvs[i];
+    }
+
+    sceneShapesDirty = true; // []   ۸ ٽ   ݿ
+}
+
+// []  ȿ ٷ  ڵ ȯ ( 迭 ű )
+ShapeHandle MakePoster(ShapeList& list, float x, float y, float z, float width, float height, char axis, int direction, int texLayer) {
+    ShapeHandle handle = list.Emplace();
+    Shape& s = list[handle];
+    s.shapeType = 'p'; // poster
+    s.primitiveType = GL_TRIANGLES;
+    s.textureLayer = texLayer;
+    s.color[0] = 1.0f; s.color[1] = 1.0f; s.color[2] = 1.0f;
+    s.x = x; s.y = y; s.z = z;
+
+    float w = width / 2.0f;
+    float h = height / 2.0f;
+
+    // 1. (Vertex) 
+    if (axis == 'z') { // /  ٴ 
+        // direction: 1̸ Z+ (), -1̸ Z- (ĸ) ٶ
+        // 츮  '' ٿ ϹǷ,  Z-  ʹ Z+  .
+        if (direction == 1) {
+            // Z+  (κ   پ   - 1 )
+            s.vertices = { -w,-h,0,  w,-h,0,  w, h,0,  -w,-h,0,  w, h,0,  -w, h,0 };
+            s.normals = { 0, 0,1,  0, 0,1,  0, 0,1,   0, 0,1,  0, 0,1,   0, 0,1 };
+        }
+        else {
+            // Z-  (κ   پ ڸ  - 4 )
+            s.vertices = { w,-h,0, -w,-h,0, -w, h,0,   w,-h,0, -w, h,0,   w, h,0 };
+            s.normals = { 0, 0,-1, 0, 0,-1, 0, 0,-1,  0, 0,-1, 0, 0,-1,  0, 0,-1 };
+        }
+    }
+    else if (axis == 'x') { // /  ٴ 
+        if (direction == 1) {
+            // X+  (κ   پ   - 2 )
+            s.vertices = { 0,-h, w,  0,-h,-w,  0, h,-w,  0,-h, w,  0, h,-w,  0, h, w };
+            s.normals = { 1, 0, 0,  1, 0, 0,  1, 0, 0,  1, 0, 0,  1, 0, 0,  1, 0, 0 };
+        }
+        else {
+            // X-  (κ   پ   - 3 )
+            s.vertices = { 0,-h,-w,  0,-h, w,  0, h, w,  0,-h,-w,  0, h, w,  0, h,-w };
+            s.normals = { -1,0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0 };
+        }
+    }
+
+    // 2. ؽó ǥ (UV) -  (Flip) 
+    s.uvs = {
+        0.0f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f,
+        0.0f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f
+    };
+
+    s.vertexCount = 6;
+
+    sceneShapesDirty = true;
+    return handle;
+}
+
+// ̴, ؽó, κ/÷̾  (â  --bench , GL ؽƮ   ȣ)
+void InitScene() {
+    // [߰] GL 4.3 ( ׸ + SSBO)̸  ü н   
+    sceneGeometry.multiDraw = multiDrawRequested && GLEW_VERSION_4_3;
+    // [] ̴  Ѳ  û ϰ ٷ  (ũ Ϸ Ӹ Ȯ)
+    // GL_KHR_parallel_shader_compile̸ ̹ 忡  
+    if (GLEW_KHR_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        parallelShaderCompile = true;
+    }
+    for (int v = 0; v < DRAW_VARIANTS; ++v) RequestShaderVariant(v | (sceneGeometry.multiDraw ? SHADER_MULTIDRAW : 0));
+    InitTextRenderer();
+    InitProfiler();
+    InitObjectRing(sceneGeometry.multiDraw);
+    InitSceneGeometry(); // []  ε    
+    if (sceneGeometry.multiDraw && gpuCullingRequested && (GLEW_VERSION_4_3 || GLEW_ARB_compute_shader)) InitGpuCulling();
+    printf("[Render] %s\n", sceneGeometry.multiDraw ? "glMultiDrawArraysIndirect (one per pass)" : "glDrawArrays per shape");
+
+    // [߰] ؽó ε   
+    // [] ۾ 忡 ڵ, ϷǴ  drawScene ε
+    rockTextureLayer = loadTextureAsync("rock.png");
+    wallTextureLayer = loadTextureAsync("background.png");
+
+    texCtrl1 = loadTextureAsync("game_ctrl1.png"); // WASD
+    texCtrl2 = loadTextureAsync("game_ctrl2.png"); // Space
+    texCtrl3 = loadTextureAsync("game_ctrl3.png"); // Mouse
+    texCtrl4 = loadTextureAsync("game_ctrl4.png"); // Reset/Goal
+    StartTextureWorkers();
+
+    GenerateLobby();
+
+    playerShape = ShapeSave(shapes, '1', 1.0f, 0.2f, 0.2f, rock.radius, rock.radius, rock.radius);
+
+    StartRenderPrep(); // [߰]  -> ׸  ۼ 
+}
+
+void main(int argc, char** argv)
+{
+    //  õ
+    //srand((unsigned int)time(NULL));
+    // [߰]   Ķ (--map-config  / --map-set key=value)
+    if (!ParseMapArgs(argc, argv)) exit(1);
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--no-mdi") == 0) multiDrawRequested = false; //  glDrawArrays 
+        if (strcmp(argv[i], "--no-gpu-cull") == 0) gpuCullingRequested = false; //   CPU 
+        if (strcmp(argv[i], "--no-render-thread") == 0) renderPrep.threaded = false; // ׸  GL 忡 ۼ
+        if (strcmp(argv[i], "--no-sim-thread") == 0) simThread.threaded = false; //  ƽ FrameIdle 
+        if (strcmp(argv[i], "--no-interpolate") == 0) frameScheduler.interpolate = false; //  ƽ   ׸
+        if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) jobSystem.requestedWorkers = std::max(0, atoi(argv[++i])); // ۾  
+    }
+    StartJobSystem(DefaultJobWorkers());
+
+    //   õ
+    srand(mapSeed);
+
+    // [߰] â  ũ ġũ (--bench) / ùķ̼ ġũ (--bench-sim) / Է  (--replay)
+    const char* recordPath = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            exit(RunBenchmark(argc, argv));
+        }
+        if (strcmp(argv[i], "--bench-sim") == 0) {
+            exit(RunSimBenchmark(argc, argv));
+        }
+        if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            exit(RunReplay(argv[i + 1]));
+        }
+        if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        }
+    }
+
+    glutInit(&argc, argv);
+    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
+    glutInitContextVersion(3, 3); // [߰]    3.3 ھ Ϸ 
+    glutInitContextProfile(GLUT_CORE_PROFILE);
+    glutInitWindowPosition(100, 100);
+    glutInitWindowSize(g_width, g_height);
+    glutCreateWindow("ROCK UP - Jump to Fall");
+
+    glewExperimental = GL_TRUE;
+    if (glewInit() != GLEW_OK) return;
+
+    InitScene();
+    if (recordPath) StartInputRecord(recordPath);
+    StartSimulationThread(); // [߰]     (ƽ )
+
+    glutDisplayFunc(drawScene);
+    glutReshapeFunc(Reshape);
+    glutKeyboardFunc(Keyboard);
+    glutKeyboardUpFunc(KeyboardUp);
+    glutMouseFunc(Mouse);
+    glutMotionFunc(Motion);
+
+    // [] glutTimerFunc(16)  steady_clock   ٷ
+#ifdef _WIN32
+    timeBeginPeriod(1);
+#endif
+    SetFrameMode(frameScheduler.mode);
+    glutIdleFunc(FrameIdle);
+    glutMainLoop();
+}
+
+// ---  Լ ---
+// [߰]    ͸    ( / Ŭ) - ޽  ȯ  Ʒ ó
+// []   ޽  ° ȯϰ,  / 浹ü 迭 Ʒ°  -    / Ҵ 
+// ( Ҹڴ  ϵ   ʹ ̹  ־ ƹ͵  )
+void ReleaseRunData() {
+    ReleaseRunMeshes();
+    mapShapes.Reset(RunAllocator<Shape>(&runArena));
+    mapBlocks = BlockList(BlockList::allocator_type(&runArena));
+    runArena.Reset();
+    sceneShapesDirty = true;
+}
+
+void ResetGame() {
+    currentState = LOBBY;
+    rock.Reset();
+    isDoorOpen = false; // ٴ ݱ
+
+    // Ÿ̸ ʱȭ
+    isTimerRunning = false;
+    gameTime = 0.0f;
+
+    srand(mapSeed);
+
+    ReleaseRunData();
+
+    // κ ٴ() ġ 󺹱
+    for (auto& s : lobbyShapes) {
+        if (s.isDoor) {
+            s.x = s.initX;
+            s.y = s.initY;
+            s.z = s.initZ;
+        }
+    }
+
+    cameraYaw = 270.0f;
+    cameraPitch = 20.0f;
+}
+
+// --- ݹ Լ ---
+GLvoid Keyboard(unsigned char key, int x, int y) {
+    // []  ¸ ٲٴ Է(̵ Ű, r/g/space) Է ť ->   ƽ ۿ  (/  )
+    inputQueue.Push({ INPUT_EVENT_KEY_DOWN, key, 0.0f, 0.0f, false });
+    if (key == '1') {
+        camera_mode = 1;
+    }
+    if (key == '2')
+    {
+        camera_mode = 2;
+    }
+
+    if (key == 'q' || key == 'Q') exit(0);
+    if (key == 'p' || key == 'P') profiler.overlayVisible = !profiler.overlayVisible; // Ϸ 
+    if (key == 'v' || key == 'V') SetFrameMode((FrameMode)((frameScheduler.mode + 1) % 3)); //   ȯ
+}
+
+void TeleportToGoal() {
+    printf("DEBUG: Teleport to Goal!\n");
+
+    //  κ񿡼 ٷ ٸ   ·    
+    if (currentState != PLAYING) {
+        currentState = PLAYING;
+        GenerateMap(); // ʰ  (Ȳ ) 
+
+        // Ÿ̸   (׽Ʈ)
+        if (!isTimerRunning) {
+            startTick = simTick;
+            isTimerRunning = true;
+            gameTime = 0.0f;
+        }
+    }
+
+    // ǥ  ǥ  (GenerateMap  GoalHeight )
+    float goalY = GoalHeight();
+
+    // ÷̾ ǥ  (+30) ̵
+    rock.position = glm::vec3(0.0f, goalY + 30.0f, 0.0f);
+
+    // 鼭 浹ϵ ӵ ʱȭ
+    rock.velocity = glm::vec3(0.0f, 0.0f, 0.0f);
+}
+
+void Jump() {
+    if (rock.isGrounded) {
+        float speed = sqrt(rock.velocity.x * rock.velocity.x + rock.velocity.z * rock.velocity.z);
+        float bonus = speed * 1.2f;
+        rock.velocity.y = rock.jumpForce + bonus;
+
+        // [] κ񿡼 ϸ ٴ  Ʈ ۵
+        if (currentState == LOBBY) {
+            isDoorOpen = true;
         }
     }
 }
 
 GLvoid KeyboardUp(unsigned char key, int x, int y) {
-    keyState[key] = false;
+    inputQueue.Push({ INPUT_EVENT_KEY_UP, key, 0.0f, 0.0f, false });
 }
 
 void Mouse(int button, int state, int x, int y) {
@@ -451,12 +3023,12 @@ void Motion(int x, int y) {
    
     if (isDragging) {
 
+        // []  ùķ̼   - ȭ Է ť (ApplyInputEvent )
         if (camera_mode == 1)
         {
             int dx = x - lastMouseX;
-            cameraYaw -= dx * mouseSensitivity;
+            inputQueue.Push({ INPUT_EVENT_LOOK, 0, -dx * mouseSensitivity, 0.0f, false });
             lastMouseX = x; lastMouseY = y;
-            glutPostRedisplay();
         }
         else if (camera_mode == 2)
         {
@@ -465,24 +3037,18 @@ void Motion(int x, int y) {
 
             if (abs(dx) > abs(dy)) {
                 // (¿)   Ŭ  -> Yaw 
-                cameraYaw -= dx * mouseSensitivity;
+                inputQueue.Push({ INPUT_EVENT_LOOK, 0, -dx * mouseSensitivity, 0.0f, true });
             }
             else {
                 // ()   Ŭ  -> Pitch 
-                cameraPitch -= dy * mouseSensitivity;
+                inputQueue.Push({ INPUT_EVENT_LOOK, 0, 0.0f, -dy * mouseSensitivity, true });
             }
 
-            //  ÷ٺ   (ڸ 0  Ҽ  Ĵٺϴ)
-            if (cameraPitch < -5.0f) cameraPitch = -5.0f;
-
-            // Ʒ ٺ   ( Ȯ  ˳ϰ)
-            if (cameraPitch > 40.0f) cameraPitch = 40.0f;
-
             //  콺 ġ 
             lastMouseX = x;
             lastMouseY = y;
         }
-        glutPostRedisplay();
+        RequestRedraw(); // []    û   
     }
 }
 
@@ -498,48 +3064,56 @@ void GenerateLobby() {
     float offset = thickness + 0.1f; //   ¦ 
     float posterY = lobbyY - 7.0f;  // 
 
+    // []    ä  Ͽ  (     )
     // 1. ٴ () -  
-    Shape* floorL = ShapeSave(lobbyShapes, 'c', 0.3f, 0.3f, 0.3f, size / 2, thickness, size);
-    floorL->x = -size / 2; floorL->y = lobbyY - size; floorL->z = 0;
-    floorL->initX = floorL->x; floorL->initY = floorL->y; floorL->initZ = floorL->z;
-    floorL->isDoor = true; floorL->doorDirection = -1;
+    Shape floorL = MakeShape('c', 0.3f, 0.3f, 0.3f, size / 2, thickness, size);
+    floorL.x = -size / 2; floorL.y = lobbyY - size; floorL.z = 0;
+    floorL.initX = floorL.x; floorL.initY = floorL.y; floorL.initZ = floorL.z;
+    floorL.isDoor = true; floorL.doorDirection = -1;
+    ShapeSave(lobbyShapes, std::move(floorL));
     lobbyBlocks.push_back({ glm::vec3(-size / 2, lobbyY - size, 0), glm::vec3(size / 2, thickness, size) });
 
-    Shape* floorR = ShapeSave(lobbyShapes, 'c', 0.3f, 0.3f, 0.3f, size / 2, thickness, size);
-    floorR->x = size / 2; floorR->y = lobbyY - size; floorR->z = 0;
-    floorR->initX = floorR->x; floorR->initY = floorR->y; floorR->initZ = floorR->z;
-    floorR->isDoor = true; floorR->doorDirection = 1;
+    Shape floorR = MakeShape('c', 0.3f, 0.3f, 0.3f, size / 2, thickness, size);
+    floorR.x = size / 2; floorR.y = lobbyY - size; floorR.z = 0;
+    floorR.initX = floorR.x; floorR.initY = floorR.y; floorR.initZ = floorR.z;
+    floorR.isDoor = true; floorR.doorDirection = 1;
+    ShapeSave(lobbyShapes, std::move(floorR));
     lobbyBlocks.push_back({ glm::vec3(size / 2, lobbyY - size, 0), glm::vec3(size / 2, thickness, size) });
 
     // 2. õ -  
-    Shape* ceil = ShapeSave(lobbyShapes, 'c', 0.3f, 0.3f, 0.3f, size, thickness, size);
-    ceil->x = 0; ceil->y = lobbyY + size; ceil->z = 0;
+    Shape ceil = MakeShape('c', 0.3f, 0.3f, 0.3f, size, thickness, size);
+    ceil.x = 0; ceil.y = lobbyY + size; ceil.z = 0;
+    ShapeSave(lobbyShapes, std::move(ceil));
     lobbyBlocks.push_back({ glm::vec3(0, lobbyY + size, 0), glm::vec3(size, thickness, size) });
 
 
     // --- 3.   (ȸ ) ---
     //  (WASD )
-    Shape* back = ShapeSave(lobbyShapes, 'c', 0.4f, 0.4f, 0.4f, size, size, thickness);
-    back->x = 0; back->y = lobbyY; back->z = -size;
-    back->isObstacle = true; back->isWall = false;
+    Shape back = MakeShape('c', 0.4f, 0.4f, 0.4f, size, size, thickness);
+    back.x = 0; back.y = lobbyY; back.z = -size;
+    back.isObstacle = true; back.isWall = false;
+    ShapeSave(lobbyShapes, std::move(back));
     lobbyBlocks.push_back({ glm::vec3(0, lobbyY, -size), glm::vec3(size, size, thickness) });
 
     //  (Reset )
-    Shape* front = ShapeSave(lobbyShapes, 'c', 0.4f, 0.4f, 0.4f, size, size, thickness);
-    front->x = 0; front->y = lobbyY; front->z = size;
-    front->isObstacle = true; front->isWall = false;
+    Shape front = MakeShape('c', 0.4f, 0.4f, 0.4f, size, size, thickness);
+    front.x = 0; front.y = lobbyY; front.z = size;
+    front.isObstacle = true; front.isWall = false;
+    ShapeSave(lobbyShapes, std::move(front));
     lobbyBlocks.push_back({ glm::vec3(0, lobbyY, size), glm::vec3(size, size, thickness) });
 
     //  (Jump )
-    Shape* left = ShapeSave(lobbyShapes, 'c', 0.4f, 0.4f, 0.4f, thickness, size, size);
-    left->x = -size; left->y = lobbyY; left->z = 0;
-    left->isWall = false;
+    Shape left = MakeShape('c', 0.4f, 0.4f, 0.4f, thickness, size, size);
+    left.x = -size; left.y = lobbyY; left.z = 0;
+    left.isWall = false;
+    ShapeSave(lobbyShapes, std::move(left));
     lobbyBlocks.push_back({ glm::vec3(-size, lobbyY, 0), glm::vec3(thickness, size, size) });
 
     //  (Mouse )
-    Shape* right = ShapeSave(lobbyShapes, 'c', 0.4f, 0.4f, 0.4f, thickness, size, size);
-    right->x = size; right->y = lobbyY; right->z = 0;
-    right->isWall = false;
+    Shape right = MakeShape('c', 0.4f, 0.4f, 0.4f, thickness, size, size);
+    right.x = size; right.y = lobbyY; right.z = 0;
+    right.isWall = false;
+    ShapeSave(lobbyShapes, std::move(right));
     lobbyBlocks.push_back({ glm::vec3(size, lobbyY, 0), glm::vec3(thickness, size, size) });
 
 
@@ -565,74 +3139,162 @@ void GenerateLobby() {
 
     for (float y = 0; y < shaftHeight; y += segmentH) {
         float g = (int(y / segmentH) % 2 == 0) ? 0.2f : 0.4f;
-        Shape* w1 = ShapeSave(lobbyShapes, 'c', g, g, g, shaftR, segmentH / 2, thickness);
-        w1->x = 0; w1->y = y - 20.0f; w1->z = shaftR; w1->isObstacle = true;
+        Shape w1 = MakeShape('c', g, g, g, shaftR, segmentH / 2, thickness);
+        w1.x = 0; w1.y = y - 20.0f; w1.z = shaftR; w1.isObstacle = true;
+        ShapeSave(lobbyShapes, std::move(w1));
+
+        Shape w2 = MakeShape('c', g, g, g, shaftR, segmentH / 2, thickness);
+        w2.x = 0; w2.y = y - 20.0f; w2.z = -shaftR; w2.isObstacle = true;
+        ShapeSave(lobbyShapes, std::move(w2));
 
-        Shape* w2 = ShapeSave(lobbyShapes, 'c', g, g, g, shaftR, segmentH / 2, thickness);
-        w2->x = 0; w2->y = y - 20.0f; w2->z = -shaftR; w2->isObstacle = true;
+        Shape w3 = MakeShape('c', g - 0.1f, g - 0.1f, g - 0.1f, thickness, segmentH / 2, shaftR);
+        w3.x = -shaftR; w3.y = y - 20.0f; w3.z = 0;
+        ShapeSave(lobbyShapes, std::move(w3));
 
-        Shape* w3 = ShapeSave(lobbyShapes, 'c', g - 0.1f, g - 0.1f, g - 0.1f, thickness, segmentH / 2, shaftR);
-        w3->x = -shaftR; w3->y = y - 20.0f; w3->z = 0;
+        Shape w4 = MakeShape('c', g - 0.1f, g - 0.1f, g - 0.1f, thickness, segmentH / 2, shaftR);
+        w4.x = shaftR; w4.y = y - 20.0f; w4.z = 0;
+        ShapeSave(lobbyShapes, std::move(w4));
+    }
+
+    // 6.  ʴ /õ/ͳ, ͸  ϳ ۷  (  ׸ )
+    BuildStaticBatch(lobbyShapes);
+}
+
+// ---    ---
+// (isDoor)    ǥ ȯ VAO   ħ
+// -   : /õ/ͳ ( )
+// - ؽó  :  ( ؽó 迭 ̾)
+void AppendToBatch(Shape& batch, Shape& s) {
+    for (int i = 0; i < s.vertexCount; ++i) {
+        batch.vertices.push_back(s.vertices[i * 3 + 0] + s.x);
+        batch.vertices.push_back(s.vertices[i * 3 + 1] + s.y);
+        batch.vertices.push_back(s.vertices[i * 3 + 2] + s.z);
+        batch.colors.push_back(s.color[0]);
+        batch.colors.push_back(s.color[1]);
+        batch.colors.push_back(s.color[2]);
+        if (batch.hasVertexLayers) batch.layers.push_back((float)s.textureLayer);
+    }
+    batch.normals.insert(batch.normals.end(), s.normals.begin(), s.normals.end());
+    batch.uvs.insert(batch.uvs.end(), s.uvs.begin(), s.uvs.end());
+}
 
-        Shape* w4 = ShapeSave(lobbyShapes, 'c', g - 0.1f, g - 0.1f, g - 0.1f, thickness, segmentH / 2, shaftR);
-        w4->x = shaftR; w4->y = y - 20.0f; w4->z = 0;
+void BuildStaticBatch(ShapeList& list) {
+    Shape colorBatch;
+    colorBatch.shapeType = 'b';
+    colorBatch.primitiveType = GL_TRIANGLES;
+    colorBatch.isStaticBatch = true;
+    colorBatch.color[0] = 1.0f; colorBatch.color[1] = 1.0f; colorBatch.color[2] = 1.0f;
+
+    Shape textureBatch = colorBatch;
+    textureBatch.isStaticBatch = false;
+    textureBatch.hasVertexLayers = true;
+
+    sceneShapesDirty = true;
+    // []    -  ( ) ڵ ״
+    list.RemoveIf([&](Shape& s) {
+        bool isStatic = !s.isDoor && !s.isWall && s.primitiveType == GL_TRIANGLES;
+        if (!isStatic) return false;
+        if (s.textureLayer >= 0) {
+            AppendToBatch(textureBatch, s);
+            textureBatchLayers |= 1u << s.textureLayer;
+        }
+        else AppendToBatch(colorBatch, s);
+        return true;
+    });
+
+    for (Shape* batch : { &colorBatch, &textureBatch }) {
+        if (batch->vertices.empty()) continue;
+        batch->vertexCount = batch->vertices.size() / 3;
+        list.Emplace(std::move(*batch));
+        printf("Static batch: %d vertices\n", batch->vertexCount);
     }
 }
 
 // ---    ---
 void GenerateMap() {
-    float floorSize = MAP_WIDTH / 2.0f;
-    Shape* s = ShapeSave(mapShapes, 'c', 0.2f, 0.8f, 0.2f, floorSize, 1.0f, floorSize);
-    s->x = 0.0f; s->y = -2.0f; s->z = 0.0f;
-    mapBlocks.push_back({ glm::vec3(0, -2.0f, 0), glm::vec3(floorSize, 1.0f, floorSize) });
-
-    float wallHeight = MAP_HEIGHT + 100.0f;
+    const MapConfig& cfg = mapConfig;
+    int platformLayers = (cfg.layers + cfg.layerStep - 1) / cfg.layerStep;
+    mapShapes.reserve(mapShapes.size() + 6 + platformLayers * cfg.platformsMax);
+    mapBlocks.reserve(mapBlocks.size() + 6 + platformLayers * cfg.platformsMax);
+
+    float floorSize = cfg.width / 2.0f;
+    float floorDepth = cfg.depth / 2.0f;
+    Shape s = MakeShape('c', 0.2f, 0.8f, 0.2f, floorSize, 1.0f, floorDepth);
+    s.x = 0.0f; s.y = -2.0f; s.z = 0.0f;
+    ShapeSave(mapShapes, std::move(s));
+    mapBlocks.push_back({ glm::vec3(0, -2.0f, 0), glm::vec3(floorSize, 1.0f, floorDepth) });
+
+    float wallHeight = cfg.layers + 100.0f;
     float wallT = 10.0f;
-    float offset = floorSize + wallT;
+    float offsetX = floorSize + wallT;
+    float offsetZ = floorDepth + wallT;
 
-    mapBlocks.push_back({ glm::vec3(offset, wallHeight / 2, 0), glm::vec3(wallT, wallHeight, floorSize) });
-    mapBlocks.push_back({ glm::vec3(-offset, wallHeight / 2, 0), glm::vec3(wallT, wallHeight, floorSize) });
-    mapBlocks.push_back({ glm::vec3(0, wallHeight / 2, offset), glm::vec3(floorSize, wallHeight, wallT) });
-    mapBlocks.push_back({ glm::vec3(0, wallHeight / 2, -offset), glm::vec3(floorSize, wallHeight, wallT) });
+    mapBlocks.push_back({ glm::vec3(offsetX, wallHeight / 2, 0), glm::vec3(wallT, wallHeight, floorDepth) });
+    mapBlocks.push_back({ glm::vec3(-offsetX, wallHeight / 2, 0), glm::vec3(wallT, wallHeight, floorDepth) });
+    mapBlocks.push_back({ glm::vec3(0, wallHeight / 2, offsetZ), glm::vec3(floorSize, wallHeight, wallT) });
+    mapBlocks.push_back({ glm::vec3(0, wallHeight / 2, -offsetZ), glm::vec3(floorSize, wallHeight, wallT) });
 
     float bgDist = 300.0f;
     float bgSize = 400.0f;
     float bgT = 1.0f;
-    Shape* bg1 = ShapeSave(mapShapes, 'c', 0.4f, 0.5f, 0.6f, bgT, bgSize, bgSize); bg1->x = bgDist; bg1->y = 100; bg1->z = 0;
-    bg1->isObstacle = true;
-    bg1->isWall = true;
-    Shape* bg2 = ShapeSave(mapShapes, 'c', 0.4f, 0.5f, 0.6f, bgT, bgSize, bgSize); bg2->x = -bgDist; bg2->y = 100; bg2->z = 0;
-    bg2->isObstacle = true;
-    bg2->isWall = true;
-    Shape* bg3 = ShapeSave(mapShapes, 'c', 0.4f, 0.5f, 0.6f, bgSize, bgSize, bgT); bg3->x = 0; bg3->y = 100; bg3->z = bgDist;
-    bg3->isObstacle = true;
-    bg3->isWall = true;
-    Shape* bg4 = ShapeSave(mapShapes, 'c', 0.4f, 0.5f, 0.6f, bgSize, bgSize, bgT); bg4->x = 0; bg4->y = 100; bg4->z = -bgDist;
-    bg4->isObstacle = true;
-    bg4->isWall = true;
-
-    float range = (MAP_WIDTH / 2.0f) - 5.0f;
-    for (int y = 0; y < MAP_HEIGHT; ++y) {
-        if (y % 2 != 0) continue;
-        int blocks = (rand() % 2) + 1;
+    Shape bg1 = MakeShape('c', 0.4f, 0.5f, 0.6f, bgT, bgSize, bgSize); bg1.x = bgDist; bg1.y = 100; bg1.z = 0;
+    bg1.isObstacle = true;
+    bg1.isWall = true;
+    ShapeSave(mapShapes, std::move(bg1));
+    Shape bg2 = MakeShape('c', 0.4f, 0.5f, 0.6f, bgT, bgSize, bgSize); bg2.x = -bgDist; bg2.y = 100; bg2.z = 0;
+    bg2.isObstacle = true;
+    bg2.isWall = true;
+    ShapeSave(mapShapes, std::move(bg2));
+    Shape bg3 = MakeShape('c', 0.4f, 0.5f, 0.6f, bgSize, bgSize, bgT); bg3.x = 0; bg3.y = 100; bg3.z = bgDist;
+    bg3.isObstacle = true;
+    bg3.isWall = true;
+    ShapeSave(mapShapes, std::move(bg3));
+    Shape bg4 = MakeShape('c', 0.4f, 0.5f, 0.6f, bgSize, bgSize, bgT); bg4.x = 0; bg4.y = 100; bg4.z = -bgDist;
+    bg4.isObstacle = true;
+    bg4.isWall = true;
+    ShapeSave(mapShapes, std::move(bg4));
+
+    // ⺻ ̸    rand() Һ ->  õ忡  
+    // [] 1)  ġ(rand)   忡, 2)  ()  ۾ ٷ 
+    struct PlatformSpec { float x, y, z, sx, sz, cVal; };
+    RunVector<PlatformSpec> platforms{ RunAllocator<PlatformSpec>(&runArena) }; //    Բ 
+    platforms.reserve(platformLayers * cfg.platformsMax);
+    float rangeX = (cfg.width / 2.0f) - 5.0f;
+    float rangeZ = (cfg.depth / 2.0f) - 5.0f;
+    int platformSpread = cfg.platformsMax - cfg.platformsMin + 1;
+    int sizeSteps = (int)((cfg.sizeMax - cfg.sizeMin) * 10.0f + 0.5f) + 1;
+    for (int y = 0; y < cfg.layers; ++y) {
+        if (y % cfg.layerStep != 0) continue;
+        int blocks = (rand() % platformSpread) + cfg.platformsMin;
         for (int i = 0; i < blocks; ++i) {
-            float nextX = ((rand() % 100) / 100.0f * (range * 2)) - range;
-            float nextZ = ((rand() % 100) / 100.0f * (range * 2)) - range;
-            float sx = 4.0f + (rand() % 30) / 10.0f;
-            float sz = 4.0f + (rand() % 30) / 10.0f;
-
-            float cVal = (float)y / MAP_HEIGHT;
-            Shape* p = ShapeSave(mapShapes, 'c', cVal, 0.6f, 1.0f - cVal, sx, 0.5f, sz);
-            p->x = nextX; p->y = (float)y * 3.0f; p->z = nextZ;
-            mapBlocks.push_back({ glm::vec3(nextX, p->y, nextZ), glm::vec3(sx, 0.5f, sz) });
+            float nextX = ((rand() % 100) / 100.0f * (rangeX * 2)) - rangeX;
+            float nextZ = ((rand() % 100) / 100.0f * (rangeZ * 2)) - rangeZ;
+            float sx = cfg.sizeMin + (rand() % sizeSteps) / 10.0f;
+            float sz = cfg.sizeMin + (rand() % sizeSteps) / 10.0f;
+
+            float cVal = (float)y / cfg.layers;
+            platforms.push_back({ nextX, (float)y * cfg.layerSpacing, nextZ, sx, sz, cVal });
+            mapBlocks.push_back({ glm::vec3(nextX, (float)y * cfg.layerSpacing, nextZ), glm::vec3(sx, 0.5f, sz) });
         }
     }
 
+    size_t base = mapShapes.Extend(platforms.size());
+    ParallelFor(0, (int)platforms.size(), 64, [&](int lo, int hi) {
+        for (int i = lo; i < hi; ++i) {
+            const PlatformSpec& ps = platforms[i];
+            Shape& p = mapShapes[base + i];
+            p = MakeShape('c', ps.cVal, 0.6f, 1.0f - ps.cVal, ps.sx, 0.5f, ps.sz);
+            p.x = ps.x; p.y = ps.y; p.z = ps.z;
+        }
+    });
+    sceneShapesDirty = true;
+
     //  Ȳ ǥ (Goal) 
-    float goalY = (MAP_HEIGHT * 3.0f) + 5.0f; //     
-    Shape* goal = ShapeSave(mapShapes, 'c', 1.0f, 0.84f, 0.0f, 3.0f, 3.0f, 3.0f); // Ȳݻ ť
-    goal->x = 0; goal->y = goalY; goal->z = 0;
-    goal->isDoor = true; // ǻ isDoor ÷׸ "ǥ" ǥ÷ Ȱմϴ
+    float goalY = GoalHeight(); //     
+    Shape goal = MakeShape('c', 1.0f, 0.84f, 0.0f, 3.0f, 3.0f, 3.0f); // Ȳݻ ť
+    goal.x = 0; goal.y = goalY; goal.z = 0;
+    goal.isDoor = true; // ǻ isDoor ÷׸ "ǥ" ǥ÷ Ȱմϴ
+    ShapeSave(mapShapes, std::move(goal));
 
     // ǥ 浹ü  (ų   ְ)
     mapBlocks.push_back({ glm::vec3(0, goalY, 0), glm::vec3(3.0f, 3.0f, 3.0f) });
@@ -688,261 +3350,1127 @@ void UpdatePhysics() {
             }
         }
 
-        if (nextPos.y > 175.0f) {
-            for (const auto& block : lobbyBlocks) {
-                // ٴ  ٴ(y < 190 ó) 浹  -> ߶
-                if (isDoorOpen && block.first.y < 190.0f) continue;
+        if (nextPos.y > 175.0f) {
+            for (const auto& block : lobbyBlocks) {
+                // ٴ  ٴ(y < 190 ó) 浹  -> ߶
+                if (isDoorOpen && block.first.y < 190.0f) continue;
+
+                if (CheckCollision(nextPos, rock.radius, block.first, block.second)) {
+                    if (rock.position.y > block.first.y + block.second.y && rock.velocity.y < 0) {
+                        rock.isGrounded = true; rock.velocity.y = 0;
+                        nextPos.y = block.first.y + block.second.y + rock.radius;
+                    }
+                    else {
+                        rock.velocity.x *= -0.5f; rock.velocity.z *= -0.5f; nextPos = rock.position;
+                    }
+                }
+            }
+        }
+        else {
+            currentState = FALLING; // 
+        }
+    }
+    else if (currentState == FALLING) {
+        if (nextPos.y < 5.0f) {
+            currentState = PLAYING; //  
+            GenerateMap();
+            rock.velocity.y *= 0.5f;
+
+            // Ÿ̸ 
+            startTick = simTick;
+            isTimerRunning = true;
+            gameTime = 0.0f;
+        }
+    }
+    else if (currentState == PLAYING) {
+        // Ÿ̸ 
+        if (isTimerRunning) {
+            // [] ð  ƽ   ( ÿ  )
+            gameTime = (float)((simTick - startTick) * PHYSICS_TICK_SEC);
+        }
+
+        for (const auto& block : mapBlocks) {
+            if (CheckCollision(nextPos, rock.radius, block.first, block.second)) {
+
+                // Ȳ ť(Goal) Ҵ Ȯ
+                // Ȳ ť  (GoalHeight) ְ ߾(0,0) 
+                if (block.first.y >= GoalHeight() - 0.5f && abs(block.first.x) < 1.0f && abs(block.first.z) < 1.0f) {
+                    currentState = CLEAR;
+
+                    // Ÿ̸ 
+                    isTimerRunning = false;
+
+                    // [ٽ]    Ͽ þ߸  վ
+                    ReleaseRunData();
+
+                    printf("GAME CLEAR! Time: %.2f sec\n", gameTime);
+                    return; // Լ  
+                }
+
+                if (rock.position.y > block.first.y + block.second.y && rock.velocity.y < 0) {
+                    rock.isGrounded = true; rock.velocity.y = 0;
+                    nextPos.y = block.first.y + block.second.y + rock.radius;
+                }
+                else {
+                    rock.velocity.x *= -0.8f; rock.velocity.z *= -0.8f; nextPos = rock.position;
+                }
+            }
+        }
+
+        if (nextPos.y < -15.0f) {
+            rock.position = glm::vec3(0, 5.0f, 0); rock.velocity = glm::vec3(0, 0, 0);
+        }
+    }
+    else if (currentState == CLEAR) {
+        rock.velocity = glm::vec3(0, 0, 0); //  ξ ()
+        //rock.position.y += 0.1f; // õõ õϴ 
+
+        cameraYaw += 1.0f;
+    }
+
+    rock.position = nextPos;
+
+    if (rock.isGrounded) { rock.velocity.x *= rock.friction; rock.velocity.z *= rock.friction; }
+    else { rock.velocity.x *= 0.995f; rock.velocity.z *= 0.995f; }
+
+    UpdateFollowCamera();
+}
+
+// ÷̾  ġ ȭ + 3Ī ī޶ (yaw/pitch/distance )
+void UpdateFollowCamera() {
+    if (Shape* player = shapes.Get(playerShape)) {
+        player->x = rock.position.x;
+        player->y = rock.position.y;
+        player->z = rock.position.z;
+    }
+
+    float cx = cos(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
+    float cy = sin(glm::radians(cameraPitch));
+    float cz = sin(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
+    cameraPos = rock.position + glm::vec3(cx, cy, cz) * cameraDistance;
+    cameraTarget = rock.position;
+}
+
+// [߰] ̴   - 游  (ؽƮ ̴  )  ǥ
+void RenderLoadingView() {
+    glViewport(0, 0, g_width, g_height);
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    BeginHudText();
+    RenderText(g_width / 2 - 120, g_height / 2, "LOADING...", 0.9f, 0.9f, 0.9f, 0.4f);
+    DrawHudText();
+}
+
+GLvoid drawScene() {
+    RenderFrame();
+    glutSwapBuffers();
+    EndFrame();
+}
+
+//   ׸ (  - --bench FBO ׸)
+void RenderFrame() {
+    PollTextureUploads();
+    PollProgramBuilds();
+    ProfilerBeginFrame();
+    renderStats.drawCalls = 0;
+    renderStats.triangles = 0;
+
+    // [߰] κ ̴ غ  ε ȭ
+    if (!SceneProgramsReady()) {
+        RenderLoadingView();
+        return;
+    }
+
+    // [] ׸   غ 尡    - ⼭ ø ⸸
+    const PreparedFrame& frame = AcquirePreparedFrame();
+
+    // []  ޽ Ʒ ø,  Ű  ٲ ( ڷ     )
+    UploadPendingMeshes();
+    if (frame.geometry && (!sceneGeometry.uploaded || sceneGeometry.uploaded->version != frame.geometry->version)) {
+        sceneGeometry.uploaded = frame.geometry;
+        meshArena.drawnVersion = frame.geometry->version;
+    }
+    // ø Է ö   / ؽó ° ٲ  ٽ 
+    if (gpuCulling.enabled && frame.drawCulledMap && sceneGeometry.uploaded &&
+        (gpuCulling.geometryVersion != sceneGeometry.uploaded->version || gpuCulling.textureState != textureJobsInFlight)) {
+        RebuildCullData(*sceneGeometry.uploaded);
+    }
+
+    // [߰] ƽ   -  ƽ ̹ ƽ  ðŭ ī޶ / ÷̾ ű
+    glm::mat4 mainView = frame.mainView;
+    glm::vec3 viewPos = frame.cameraPos, lightPos = frame.lightPos;
+    bool interpolated = frameScheduler.interpolate && frame.motion.active;
+    glm::mat4 playerModel;
+    if (interpolated) {
+        const TickMotion& m = frame.motion;
+        double elapsed = std::chrono::duration<double>(FrameClock::now() - m.tickTime).count();
+        float t = (float)std::min(elapsed / PHYSICS_TICK_SEC, 1.0);
+        viewPos = glm::mix(m.from.cameraPos, m.to.cameraPos, t);
+        mainView = glm::lookAt(viewPos, glm::mix(m.from.cameraTarget, m.to.cameraTarget, t), frame.cameraUp);
+        glm::vec3 playerPos = glm::mix(m.from.playerPos, m.to.playerPos, t);
+        lightPos = glm::vec3(playerPos.x, playerPos.y + 50.0f, playerPos.z);
+        playerModel = glm::translate(glm::mat4(1.0f), playerPos) * glm::mat4_cast(glm::slerp(m.from.playerOrientation, m.to.playerOrientation, t));
+    }
+
+    // ׸  (RenderPass) - н  uniform ϰ ڵ  ٲ㰡 ׸
+    // []   α׷ ٲٰ н  uniform  - ̴ ü  ŭ
+    auto RenderPass = [&](const glm::mat4& viewMatrix, const glm::mat4& projMatrix, const std::vector<DrawItem>& items, size_t commandOffset, int pass) {
+        bool drawCulled = gpuCulling.enabled && frame.drawCulledMap;
+
+        size_t begin = 0;
+        for (int variant = 0; variant < DRAW_VARIANTS; ++variant) {
+            size_t end = begin;
+            while (end < items.size() && items[end].variant == variant) ++end;
+            bool culledGroup = drawCulled && gpuCulling.groupCount[variant] > 0;
+            if (end == begin && !culledGroup) continue;
+
+            const ShaderVariant& sv = GetShaderVariant(variant | (sceneGeometry.multiDraw ? SHADER_MULTIDRAW : 0));
+            glUseProgram(sv.program);
+            glUniformMatrix4fv(sv.viewLoc, 1, GL_FALSE, &viewMatrix[0][0]);
+            glUniformMatrix4fv(sv.projLoc, 1, GL_FALSE, &projMatrix[0][0]);
+            glUniform3f(sv.lightPosLoc, lightPos.x, lightPos.y, lightPos.z);
+            glUniform3f(sv.viewPosLoc, viewPos.x, viewPos.y, viewPos.z);
+            glUniform3f(sv.lightColorLoc, 1.0f, 1.0f, 1.0f);
+            if (sv.layerScaleLoc >= 0) glUniform2fv(sv.layerScaleLoc, MAX_TEXTURE_LAYERS, &textureLayerScale[0][0]);
+
+            // [߰]   ۸      ( ̸ UploadIndirectCommands ÷ )
+            if (sceneGeometry.multiDraw) {
+                if (end > begin) {
+                    glBindVertexArray(sceneGeometry.VAO);
+                    glMultiDrawArraysIndirect(GL_TRIANGLES, (const void*)((commandOffset + begin) * sizeof(DrawArraysIndirectCommand)), (GLsizei)(end - begin), 0);
+                    renderStats.drawCalls++;
+                    for (size_t i = begin; i < end; ++i) renderStats.triangles += items[i].count / 3;
+                }
+                // [߰]   ǻƮ ø    
+                if (culledGroup) DrawGpuCulled(pass, variant);
+            }
+            else {
+                glBindVertexArray(sceneGeometry.VAO);
+                for (size_t i = begin; i < end; ++i) {
+                    const DrawItem& item = items[i];
+                    BindObjectRecord(item.record);
+                    glDrawArrays(item.primitiveType, item.sceneFirst + item.first, item.count);
+                    renderStats.drawCalls++;
+                    renderStats.triangles += item.count / 3;
+                }
+            }
+            begin = end;
+        }
+        };
+
+    // ̴ϸ Ʈ
+    bool showMiniMap = frame.showMiniMap;
+    int mapW = g_width / 5;
+    int mapH = g_height / 2.5;
+    int mapX = g_width - mapW - 20;
+    int mapY = g_height - mapH - 20;
+
+    {
+        ProfileZone zone(PROF_OBJECTS);
+        ObjectRingUpload(frame.records, frame.recordCount);
+        if (interpolated) {
+            for (int record : frame.playerRecords) ObjectRingWriteModel(record, playerModel);
+        }
+        static bool droppedWarned = false;
+        if (frame.droppedRecords > 0 && !droppedWarned) {
+            printf("[ObjectRing] %d visible objects over the %d record limit were not drawn (GPU culling draws large maps)\n",
+                frame.droppedRecords, ObjectRingMaxCapacity());
+            droppedWarned = true;
+        }
+
+        // [߰] غ   ø (  ̴ϸ)
+        if (sceneGeometry.multiDraw) {
+            UpdateDrawIds(std::max(objectRing.capacity, gpuCulling.objectCount));
+            UploadIndirectCommands(frame.commands);
+            BindObjectStorage();
+        }
+
+        // [߰]   ø (:  ü, ̴ϸ:  ڽ)
+        if (gpuCulling.enabled && frame.drawCulledMap) {
+            glm::mat4 mainViewProj = frame.mainProj * mainView;
+            glm::mat4 miniViewProj = frame.miniProj * frame.miniView;
+            const glm::mat4* viewProj[CULL_PASSES] = { &mainViewProj, showMiniMap ? &miniViewProj : NULL };
+            DispatchGpuCulling(viewProj);
+        }
+    }
+
+    // -------------------------------------------------------
+    // [STEP 1]  ȭ
+    // -------------------------------------------------------
+    glViewport(0, 0, g_width, g_height);
+    if (frame.state == CLEAR) glClearColor(1.0f, 0.84f, 0.0f, 1.0f);
+    else glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glEnable(GL_DEPTH_TEST);
+
+    // [߰]  ؽó  迭 - Ӵ   ε
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, textureArrayID);
+
+    {
+        ProfileZone zone(PROF_MAIN_PASS, true);
+        RenderPass(mainView, frame.mainProj, frame.mainItems, 0, 0);
+    }
+
+    // -------------------------------------------------------
+    // [STEP 2] ̴ϸ
+    // -------------------------------------------------------
+    if (showMiniMap) {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(mapX, mapY, mapW, mapH);
+        glClearColor(0.9f, 0.9f, 0.9f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glDisable(GL_SCISSOR_TEST);
+
+        glViewport(mapX, mapY, mapW, mapH);
+        glDisable(GL_CULL_FACE);
+
+        {
+            ProfileZone zone(PROF_MINIMAP_PASS, true);
+            RenderPass(frame.miniView, frame.miniProj, frame.miniItems, frame.mainItems.size(), 1);
+        }
+
+        glEnable(GL_CULL_FACE);
+    }
+    ObjectRingEndFrame();
+
+    {
+        ProfileZone zone(PROF_HUD, true);
+        BeginHudText();
+        if (frame.state == PLAYING || frame.state == CLEAR) {
+            sprintf(timeBuffer, "TIME: %.2f", frame.gameTime);
+            // scale 0.3f  ->  ū ũ
+            RenderText(20, g_height - 80, timeBuffer, 0.7f, 0.0f, 0.0f, 0.7f);
+        }
+
+        if (frame.state == CLEAR) {
+            // scale 0.5f  -> ſ ū ũ
+            RenderText(g_width / 2 - 200, g_height / 2, "GAME CLEAR!", 1.0f, 0.0f, 0.0f, 0.5f);
+            RenderText(g_width / 2 - 150, g_height / 2 - 100, timeBuffer, 1.0f, 0.0f, 0.0f, 0.4f);
+        }
+        RenderProfilerOverlay();
+        DrawHudText();
+    }
+
+    glUseProgram(0);
+    glBindVertexArray(0);
+}
+
+// ---  ٷ ---
+//  16ms  ƽ( Ÿ̸ ֱ) , ׸ 忡  
+// [] ƽ ̸   н ׸ - ׸ ӵ ƽ(62.5 Hz) ƴ϶ Ʒ 尡 
+// (--no-interpolate  ƽ / RequestRedraw   ׸ ->   ׸Ⱑ ƽ ӵ )
+// - FRAME_UNCAPPED:  ʰ ׸
+// - FRAME_VSYNC:   1,  ü ӵ  (WGL / GLX     Ұ)
+// - FRAME_CAPPED: targetHz  ð Sleep   FRAME_SPIN_MS ٻ 
+// []   ٲ true (Ȯ  false - ̹ ⺻ ״)
+bool SetSwapInterval(int interval) {
+#ifdef _WIN32
+    if (!WGLEW_EXT_swap_control) return false;
+    return wglSwapIntervalEXT(interval) != FALSE;
+#else
+    // GLX: EXT  ξ, MESA  ؽƮ 
+    Display* display = glXGetCurrentDisplay();
+    GLXDrawable drawable = glXGetCurrentDrawable();
+    if (GLXEW_EXT_swap_control && display && drawable) {
+        glXSwapIntervalEXT(display, drawable, interval);
+        return true;
+    }
+    if (GLXEW_MESA_swap_control) return glXSwapIntervalMESA(interval) == 0;
+    return false;
+#endif
+}
+
+void SetFrameMode(FrameMode mode) {
+    // []      vsync 带  ʰ  ()
+    if (!SetSwapInterval(mode == FRAME_VSYNC ? 1 : 0) && mode == FRAME_VSYNC) {
+        printf("Frame mode: vsync unavailable (no swap control extension)\n");
+        mode = FRAME_CAPPED;
+    }
+    frameScheduler.mode = mode;
+    frameScheduler.nextFrame = FrameClock::now();
+    const char* names[] = { "uncapped", "vsync", "capped" };
+    printf("Frame mode: %s (%.0f Hz)\n", names[mode], frameScheduler.targetHz);
+}
 
-                if (CheckCollision(nextPos, rock.radius, block.first, block.second)) {
-                    if (rock.position.y > block.first.y + block.second.y && rock.velocity.y < 0) {
-                        rock.isGrounded = true; rock.velocity.y = 0;
-                        nextPos.y = block.first.y + block.second.y + rock.radius;
-                    }
-                    else {
-                        rock.velocity.x *= -0.5f; rock.velocity.z *= -0.5f; nextPos = rock.position;
-                    }
-                }
-            }
+void RequestRedraw() {
+    frameScheduler.redrawRequested = true;
+}
+
+void FrameIdle() {
+    FrameScheduler& fs = frameScheduler;
+    FrameClock::time_point now = FrameClock::now();
+    if (fs.lastTick.time_since_epoch().count() == 0) fs.lastTick = now;
+
+    if (simThread.threaded) {
+        // [߰] ƽ ùķ̼   -     ׸
+        long long published = renderPrep.publishCount;
+        if (published != fs.drawnSnapshot) fs.redrawRequested = true;
+        if (!fs.redrawRequested && !fs.interpolate) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1)); //  ݹ ٻ  
+            return;
         }
-        else {
-            currentState = FALLING; // 
+        fs.drawnSnapshot = published;
+    }
+    else {
+        // 1. и  ƽ ó (  ִ FRAME_MAX_TICKS,  ̻ )
+        fs.tickAccumulator += std::chrono::duration<double>(now - fs.lastTick).count();
+        fs.lastTick = now;
+        int ticks = 0;
+        float tickMs = 0.0f;
+        while (fs.tickAccumulator >= PHYSICS_TICK_SEC && ticks < FRAME_MAX_TICKS) {
+            tickMs = RunSimulationStep();
+            fs.tickAccumulator -= PHYSICS_TICK_SEC;
+            ticks++;
+        }
+        if (ticks == FRAME_MAX_TICKS) fs.tickAccumulator = 0.0;
+        if (ticks > 0) fs.redrawRequested = true;
+        if (!fs.redrawRequested && !fs.interpolate) {
+            // []  ƽ  -  ݹ ھ ϳ ٻ  ä ʰ (Էµ ƽ ݿ)
+            double untilTick = PHYSICS_TICK_SEC - fs.tickAccumulator;
+            if (untilTick > 0.0) std::this_thread::sleep_for(std::chrono::duration<double>(untilTick));
+            return;
         }
+
+        // [߰] ƽ    ->  غ 尡   / ׸ ļ  ۼ
+        // []  ƽ / û   н     ٽ ׸
+        if (fs.redrawRequested) PublishRenderSnapshot(tickMs);
     }
-    else if (currentState == FALLING) {
-        if (nextPos.y < 5.0f) {
-            currentState = PLAYING; //  
-            GenerateMap();
-            rock.velocity.y *= 0.5f;
 
-            // Ÿ̸ 
-            startTime = glutGet(GLUT_ELAPSED_TIME);
-            isTimerRunning = true;
-            gameTime = 0.0f;
+    // 2.  :   (Sleep  )
+    if (fs.mode == FRAME_CAPPED) {
+        std::chrono::duration<double> period(1.0 / fs.targetHz);
+        if (now < fs.nextFrame) {
+            std::chrono::duration<double> wait = fs.nextFrame - now;
+            if (wait.count() * 1000.0 > FRAME_SPIN_MS) {
+                std::this_thread::sleep_for(wait - std::chrono::duration<double, std::milli>(FRAME_SPIN_MS));
+            }
+            while (FrameClock::now() < fs.nextFrame) {}
         }
+        now = FrameClock::now();
+
+        //    
+        double lateMs = std::chrono::duration<double, std::milli>(now - fs.nextFrame).count();
+        if (lateMs > period.count() * 1000.0 * 0.5) fs.missedDeadlines++;
+
+        fs.nextFrame += std::chrono::duration_cast<FrameClock::duration>(period);
+        if (fs.nextFrame < now) fs.nextFrame = now + std::chrono::duration_cast<FrameClock::duration>(period); // ʹ и 絿ȭ
     }
-    else if (currentState == PLAYING) {
-        // Ÿ̸ 
-        if (isTimerRunning) {
-            int currentTime = glutGet(GLUT_ELAPSED_TIME);
-            gameTime = (currentTime - startTime) / 1000.0f; // и ->  ȯ
-        }
 
-        for (const auto& block : mapBlocks) {
-            if (CheckCollision(nextPos, rock.radius, block.first, block.second)) {
+    fs.redrawRequested = false;
+    glutPostRedisplay();
+}
 
-                // Ȳ ť(Goal) Ҵ Ȯ
-                // Ȳ ť    (Y > 440) ְ ߾(0,0) 
-                if (block.first.y > 440.0f && abs(block.first.x) < 1.0f && abs(block.first.z) < 1.0f) {
-                    currentState = CLEAR;
+//   ȣ -    (5ʸ )
+void EndFrame() {
+    FrameScheduler& fs = frameScheduler;
+    FrameClock::time_point now = FrameClock::now();
+    if (fs.lastFrame.time_since_epoch().count() != 0) {
+        double ms = std::chrono::duration<double, std::milli>(now - fs.lastFrame).count();
+        fs.frameCount++;
+        fs.frameTimeSum += ms;
+        fs.frameTimeMax = std::max(fs.frameTimeMax, ms);
+        if (fs.mode != FRAME_CAPPED && ms > 1000.0 / fs.targetHz * 1.5) fs.missedDeadlines++;
+    }
+    else {
+        fs.reportTime = now;
+    }
+    fs.lastFrame = now;
+
+    if (std::chrono::duration<double>(now - fs.reportTime).count() >= 5.0 && fs.frameCount > 0) {
+        printf("Frames: %d, avg %.2f ms, max %.2f ms, missed %d, ring waits %lld, sim ticks %lld (late %lld)\n",
+            fs.frameCount, fs.frameTimeSum / fs.frameCount, fs.frameTimeMax, fs.missedDeadlines, objectRing.fenceWaits,
+            simThread.ticks.exchange(0), simThread.lateTicks.exchange(0));
+        fs.frameCount = 0; fs.frameTimeSum = 0.0; fs.frameTimeMax = 0.0; fs.missedDeadlines = 0;
+        fs.reportTime = now;
+    }
+}
 
-                    // Ÿ̸ 
-                    isTimerRunning = false;
+// --- 帮 ġũ (--bench) ---
+// â  EGL(surfaceless) ؽƮ  FBO ׸ (llvmpipe ִ  CI)
+// (LOBBY, FALLING, PLAYING, CLEAR)  ī޶ η N ׷ JSON Ʈ 
+//   RockUp --bench [--frames N] [--size WxH] [--out bench.json]
+struct BenchResult {
+    const char* state;
+    std::vector<double> frameMs;
+    double drawCalls = 0, triangles = 0; //  
+    double rssMb = 0;                     // [߰] ¸  ׸   ޸
+};
 
-                    // [ٽ]    Ͽ þ߸  վ
-                    mapShapes.clear();
-                    mapBlocks.clear();
+// º ī޶  (t: 0~1)
+void BenchSetupFrame(GameState state, float t) {
+    currentState = state;
+    cameraYaw = 270.0f + t * 360.0f;
+    cameraPitch = 20.0f;
 
-                    printf("GAME CLEAR! Time: %.2f sec\n", gameTime);
-                    return; // Լ  
-                }
+    if (state == LOBBY) {
+        rock.position = glm::vec3(sinf(t * 6.28f) * 8.0f, 181.2f, cosf(t * 6.28f) * 8.0f);
+    }
+    else if (state == FALLING) {
+        rock.position = glm::vec3(0.0f, 180.0f - t * 170.0f, 0.0f); // ͳ  
+        cameraPitch = 40.0f;
+    }
+    else if (state == PLAYING) {
+        rock.position = glm::vec3(0.0f, t * (GoalHeight() - 5.0f), 0.0f); // Ÿ  
+    }
+    else {
+        rock.position = glm::vec3(0.0f, GoalHeight() + 5.0f, 0.0f);
+    }
+    UpdateFollowCamera();
+}
 
-                if (rock.position.y > block.first.y + block.second.y && rock.velocity.y < 0) {
-                    rock.isGrounded = true; rock.velocity.y = 0;
-                    nextPos.y = block.first.y + block.second.y + rock.radius;
-                }
-                else {
-                    rock.velocity.x *= -0.8f; rock.velocity.z *= -0.8f; nextPos = rock.position;
-                }
-            }
-        }
+int RunBenchmark(int argc, char** argv) {
+#ifdef _WIN32
+    printf("--bench requires EGL (Linux only)\n");
+    return 1;
+#else
+    int frames = 300;
+    const char* outPath = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) { int w = g_width, h = g_height; sscanf(argv[++i], "%dx%d", &w, &h); SetViewSize(w, h); }
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) outPath = argv[++i];
+    }
 
-        if (nextPos.y < -15.0f) {
-            rock.position = glm::vec3(0, 5.0f, 0); rock.velocity = glm::vec3(0, 0, 0);
-        }
+    // 1. surfaceless EGL + 3.3 ھ ؽƮ
+    EGLDisplay dpy = EGL_NO_DISPLAY;
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay) dpy = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if (dpy == EGL_NO_DISPLAY) dpy = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (dpy == EGL_NO_DISPLAY || !eglInitialize(dpy, NULL, NULL)) {
+        printf("Bench: EGL initialize failed\n");
+        return 1;
     }
-    else if (currentState == CLEAR) {
-        rock.velocity = glm::vec3(0, 0, 0); //  ξ ()
-        //rock.position.y += 0.1f; // õõ õϴ 
 
-        cameraYaw += 1.0f;
+    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_SURFACE_TYPE, 0, EGL_NONE };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    eglBindAPI(EGL_OPENGL_API);
+    if (!eglChooseConfig(dpy, configAttribs, &config, 1, &numConfigs) || numConfigs == 0) {
+        printf("Bench: no EGL config\n");
+        return 1;
+    }
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE };
+    EGLContext ctx = eglCreateContext(dpy, config, EGL_NO_CONTEXT, contextAttribs);
+    if (ctx == EGL_NO_CONTEXT || !eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, ctx)) {
+        printf("Bench: EGL context failed\n");
+        return 1;
     }
 
-    rock.position = nextPos;
+    glewExperimental = GL_TRUE;
+    GLenum glewErr = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    if (glewErr == GLEW_ERROR_NO_GLX_DISPLAY) glewErr = GLEW_OK; // GLX   (EGL ؽƮ)
+#endif
+    if (glewErr != GLEW_OK) {
+        printf("Bench: glewInit failed\n");
+        return 1;
+    }
 
-    if (rock.isGrounded) { rock.velocity.x *= rock.friction; rock.velocity.z *= rock.friction; }
-    else { rock.velocity.x *= 0.995f; rock.velocity.z *= 0.995f; }
+    // 2. ũ FBO
+    GLuint fbo, colorRb, depthRb;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &colorRb);
+    glBindRenderbuffer(GL_RENDERBUFFER, colorRb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, g_width, g_height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRb);
+    glGenRenderbuffers(1, &depthRb);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthRb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, g_width, g_height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRb);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        printf("Bench: framebuffer incomplete\n");
+        return 1;
+    }
 
-    if (playerShapeIndex != -1) {
-        shapes[playerShapeIndex].x = rock.position.x;
-        shapes[playerShapeIndex].y = rock.position.y;
-        shapes[playerShapeIndex].z = rock.position.z;
+    // 3.  غ - ̴ / ؽó  غ   ( )
+    renderPrep.maxLag = 0; // ϴ    ¸ ׸
+    frameScheduler.interpolate = false; // [߰]    ״ (ȭ )
+    InitScene();
+    WaitProgramBuilds();
+    while (textureJobsInFlight > 0) {
+        PollTextureUploads();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 
-    float cx = cos(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
-    float cy = sin(glm::radians(cameraPitch));
-    float cz = sin(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
-    cameraPos = rock.position + glm::vec3(cx, cy, cz) * cameraDistance;
-    cameraTarget = rock.position;
+    // 4. º 
+    GameState states[] = { LOBBY, FALLING, PLAYING, CLEAR };
+    const char* stateNames[] = { "LOBBY", "FALLING", "PLAYING", "CLEAR" };
+    std::vector<BenchResult> results;
+
+    for (int si = 0; si < 4; ++si) {
+        GameState state = states[si];
+        ResetGame();
+        if (state == PLAYING) GenerateMap();
+        if (state == CLEAR) ReleaseRunData();
+
+        BenchResult r;
+        r.state = stateNames[si];
+        for (int f = 0; f < frames; ++f) {
+            BenchSetupFrame(state, (float)f / frames);
+            FrameClock::time_point t0 = FrameClock::now();
+            PublishRenderSnapshot(0.0f);
+            RenderFrame();
+            glFinish();
+            r.frameMs.push_back(std::chrono::duration<double, std::milli>(FrameClock::now() - t0).count());
+            r.drawCalls += renderStats.drawCalls;
+            r.triangles += renderStats.triangles;
+        }
+        r.drawCalls /= frames;
+        r.triangles /= frames;
+        r.rssMb = ResidentMemoryBytes() / (1024.0 * 1024.0);
+        results.push_back(r);
+    }
+
+    // 5. JSON Ʈ
+    FILE* out = outPath ? fopen(outPath, "w") : stdout;
+    if (!out) out = stdout;
+    fprintf(out, "{\n  \"renderer\": \"%s\",\n  \"width\": %d,\n  \"height\": %d,\n  \"frames\": %d,\n  \"states\": [\n",
+        (const char*)glGetString(GL_RENDERER), g_width, g_height, frames);
+    for (size_t i = 0; i < results.size(); ++i) {
+        std::vector<double> sorted = results[i].frameMs;
+        std::sort(sorted.begin(), sorted.end());
+        double sum = 0.0;
+        for (double ms : sorted) sum += ms;
+        auto pct = [&](double p) { return sorted[std::min(sorted.size() - 1, (size_t)(p * sorted.size()))]; };
+        fprintf(out, "    { \"state\": \"%s\", \"mean_ms\": %.3f, \"p50_ms\": %.3f, \"p99_ms\": %.3f, \"max_ms\": %.3f, \"draw_calls\": %.1f, \"triangles\": %.0f, \"rss_mb\": %.1f }%s\n",
+            results[i].state, sum / sorted.size(), pct(0.5), pct(0.99), sorted.back(),
+            results[i].drawCalls, results[i].triangles, results[i].rssMb, (i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    if (out != stdout) fclose(out);
+
+    StopRenderPrep();
+    eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(dpy, ctx);
+    eglTerminate(dpy);
+    return 0;
+#endif
 }
 
-GLvoid drawScene() {
-    // 1. ׸  (RenderPass)
-    auto RenderPass = [&](glm::mat4 viewMatrix, glm::mat4 projMatrix, bool isMiniMap = false) {
+// --- Է  /  ---
+//   ƽ Է(WASD, ī޶ yaw/pitch, //̵) õθ 
+//  : (RockUpReplayHeader) + MapConfig + ƽ [Ű 1Ʈ][̺Ʈ 1Ʈ]([yaw][pitch] - ī޶ ٲ ƽ)
+// []  2  (--map-set)  -    ÷׸ ٽ  ʾƵ   ( 1    )
+//   : RockUp --record run.rkr
+//   : RockUp --replay run.rkr   (â/  ְ ӵ ,   ؽ )
+struct RockUpReplayHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t seed;
+    uint32_t configBytes; //   MapConfig ũ ( 1: 0)
+};
+const uint32_t REPLAY_VERSION = 2;
 
-        unsigned int viewLoc = glGetUniformLocation(shaderProgramID, "view");
-        unsigned int projLoc = glGetUniformLocation(shaderProgramID, "projection");
-        unsigned int modelLoc = glGetUniformLocation(shaderProgramID, "model");
-        unsigned int colorLoc = glGetUniformLocation(shaderProgramID, "objectColor");
+FILE* inputRecordFile = NULL;
+float recordedYaw = 0.0f, recordedPitch = 0.0f;
+bool recordedCameraValid = false;
 
-        glUniformMatrix4fv(viewLoc, 1, GL_FALSE, &viewMatrix[0][0]);
-        glUniformMatrix4fv(projLoc, 1, GL_FALSE, &projMatrix[0][0]);
+unsigned char PackMoveKeys() {
+    return (keyState['w'] ? 1 : 0) | (keyState['a'] ? 2 : 0) | (keyState['s'] ? 4 : 0) | (keyState['d'] ? 8 : 0);
+}
 
-        glm::vec3 lightPos(rock.position.x, rock.position.y + 50.0f, rock.position.z);
-        glUniform3f(glGetUniformLocation(shaderProgramID, "lightPos"), lightPos.x, lightPos.y, lightPos.z);
-        glUniform3f(glGetUniformLocation(shaderProgramID, "viewPos"), cameraPos.x, cameraPos.y, cameraPos.z);
-        glUniform3f(glGetUniformLocation(shaderProgramID, "lightColor"), 1.0f, 1.0f, 1.0f);
+void UnpackMoveKeys(unsigned char keys) {
+    keyState['w'] = (keys & 1) != 0;
+    keyState['a'] = (keys & 2) != 0;
+    keyState['s'] = (keys & 4) != 0;
+    keyState['d'] = (keys & 8) != 0;
+}
 
-        auto drawList = [&](std::vector<Shape>& list, bool isPlayer = false) {
-            for (auto& s : list) {
-                if (isMiniMap && s.isObstacle) continue;
+void CloseInputRecord() {
+    if (inputRecordFile) {
+        fclose(inputRecordFile);
+        inputRecordFile = NULL;
+        printf("Input record closed (%lld ticks)\n", simTick);
+    }
+}
 
-                glUniform3fv(colorLoc, 1, s.color);
+bool StartInputRecord(const char* path) {
+    inputRecordFile = fopen(path, "wb");
+    if (!inputRecordFile) {
+        printf("Cannot open record file: %s\n", path);
+        return false;
+    }
+    RockUpReplayHeader h;
+    memcpy(h.magic, "RKRP", 4);
+    h.version = REPLAY_VERSION;
+    h.seed = mapSeed;
+    h.configBytes = sizeof(MapConfig);
+    fwrite(&h, sizeof(h), 1, inputRecordFile);
+    fwrite(&mapConfig, sizeof(MapConfig), 1, inputRecordFile);
+    atexit(CloseInputRecord); // 'q' -> exit(0)  
+    printf("Recording input to %s\n", path);
+    return true;
+}
 
-                // --- [ؽó   ] ---
-                GLuint textureToUse = 0;
+//   ƽ -   ̺Ʈ  -> Է  -> UpdatePhysics
+void SimulationTick() {
+    unsigned char events = pendingEvents;
+    pendingEvents = 0;
+
+    if (inputRecordFile) {
+        bool cameraChanged = !recordedCameraValid || cameraYaw != recordedYaw || cameraPitch != recordedPitch;
+        unsigned char keys = PackMoveKeys();
+        unsigned char flags = events | (cameraChanged ? INPUT_CAMERA : 0);
+        fputc(keys, inputRecordFile);
+        fputc(flags, inputRecordFile);
+        if (cameraChanged) {
+            fwrite(&cameraYaw, sizeof(float), 1, inputRecordFile);
+            fwrite(&cameraPitch, sizeof(float), 1, inputRecordFile);
+            recordedYaw = cameraYaw; recordedPitch = cameraPitch;
+            recordedCameraValid = true;
+        }
+    }
 
-                if (isPlayer && s.shapeType == '1') {
-                    textureToUse = rockTextureID;
-                }
-                else if (s.specificTextureID != 0) {
-                    // [ٽ]    ؽó()  װ 
-                    textureToUse = s.specificTextureID;
-                }
-                else if (s.isWall) {
-                    textureToUse = wallTextureID;
-                }
+    if (events & INPUT_RESET) ResetGame();
+    if (events & INPUT_TELEPORT) TeleportToGoal();
+    if (events & INPUT_JUMP) Jump();
 
-                // ؽó ε
-                if (textureToUse != 0) {
-                    glActiveTexture(GL_TEXTURE0);
-                    glBindTexture(GL_TEXTURE_2D, textureToUse);
-                    glUniform1i(glGetUniformLocation(shaderProgramID, "useTexture"), 1); // ON
-                }
-                else {
-                    glUniform1i(glGetUniformLocation(shaderProgramID, "useTexture"), 0); // OFF
-                }
-                // -----------------------------
+    UpdatePhysics();
+    simTick++;
+}
 
-                glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(s.x, s.y, s.z));
-                if (isPlayer && s.shapeType == '1') {
-                    model = model * glm::mat4_cast(rock.orientation);
-                }
+// --- ùķ̼  ---
+// [߰]  ƽ GL  и  忡 PHYSICS_TICK_SEC 
+// Է inputQueue ް, ƽ    PublishRenderSnapshot  ʿ ѱ (  -  ٸ )
+// ׸Ⱑ  ƽ  ǰ, ƽ з ׸   ׸
+// --no-sim-thread ó FrameIdle ƽ 
+// Է ̺Ʈ  (ùķ̼  - ƽ  )
+void ApplyInputEvent(const InputEvent& e) {
+    if (e.type == INPUT_EVENT_LOOK) {
+        cameraYaw += e.dyaw;
+        cameraPitch += e.dpitch;
+        if (e.clampPitch) {
+            //  ÷ٺ   (ڸ 0  Ҽ  Ĵٺϴ)
+            if (cameraPitch < -5.0f) cameraPitch = -5.0f;
+            // Ʒ ٺ   ( Ȯ  ˳ϰ)
+            if (cameraPitch > 40.0f) cameraPitch = 40.0f;
+        }
+        return;
+    }
+    keyState[e.key] = (e.type == INPUT_EVENT_KEY_DOWN);
+    if (e.type != INPUT_EVENT_KEY_DOWN) return;
+    if (e.key == 'r' || e.key == 'R') pendingEvents |= INPUT_RESET;
+    if (e.key == 'g' || e.key == 'G') pendingEvents |= INPUT_TELEPORT;
+    if (e.key == ' ') pendingEvents |= INPUT_JUMP;
+}
 
-                if (isMiniMap && isPlayer) {
-                    model = glm::scale(model, glm::vec3(1.0f, 1.0f, 1.0f));
-                }
+//  Է    ƽ - ɸ ð(ms) ȯ
+float RunSimulationStep() {
+    FrameClock::time_point t0 = FrameClock::now();
+    InputEvent e;
+    while (inputQueue.Pop(e)) ApplyInputEvent(e);
+    SimulationTick();
+    return std::chrono::duration<float, std::milli>(FrameClock::now() - t0).count();
+}
 
-                glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &model[0][0]);
-                glBindVertexArray(s.VAO); glDrawArrays(s.primitiveType, 0, s.vertexCount);
-            }
-        };
+void SimulationThreadMain() {
+    FrameClock::duration period = std::chrono::duration_cast<FrameClock::duration>(std::chrono::duration<double>(PHYSICS_TICK_SEC));
+    FrameClock::time_point next = FrameClock::now() + period;
+    PublishRenderSnapshot(0.0f); // ù 
+    while (!simThread.quit) {
+        std::this_thread::sleep_until(next);
+
+        // и ƽ ó (  ִ FRAME_MAX_TICKS,  ̻  絿ȭ)
+        float tickMs = 0.0f;
+        int ticks = 0;
+        FrameClock::time_point now = FrameClock::now();
+        while (now >= next && ticks < FRAME_MAX_TICKS) {
+            if (now - next >= period) simThread.lateTicks++;
+            tickMs = RunSimulationStep();
+            next += period;
+            ticks++;
+            now = FrameClock::now();
+        }
+        if (now >= next) {
+            simThread.lateTicks += (now - next) / period + 1;
+            next = now + period;
+        }
+        simThread.ticks += ticks;
+        if (ticks > 0) PublishRenderSnapshot(tickMs);
+    }
+}
+
+void StopSimulationThread() {
+    if (!simThread.worker.joinable()) return;
+    simThread.quit = true;
+    simThread.worker.join();
+}
 
-        // ÷̾ ׸
-        drawList(shapes, true);
+// InitScene( غ  ) ڿ ȣ - atexit ̶ ùķ̼ 尡  
+void StartSimulationThread() {
+    if (!simThread.threaded) return;
+    simThread.worker = std::thread(SimulationThreadMain);
+    atexit(StopSimulationThread);
+}
+
+//   ؽ (FNV-1a) -  ȭ  񱳿
+uint32_t HashSimulationState() {
+    uint32_t h = 2166136261u;
+    auto mix = [&](const void* p, size_t n) {
+        const unsigned char* b = (const unsigned char*)p;
+        for (size_t i = 0; i < n; ++i) { h ^= b[i]; h *= 16777619u; }
+    };
+    mix(&rock.position, sizeof(rock.position));
+    mix(&rock.velocity, sizeof(rock.velocity));
+    mix(&rock.orientation, sizeof(rock.orientation));
+    mix(&currentState, sizeof(currentState));
+    mix(&gameTime, sizeof(gameTime));
+    return h;
+}
 
-        if (currentState == LOBBY || currentState == FALLING) {
-            drawList(lobbyShapes, false);
+//   о ƽ   (GL ).   false
+bool ReplayInputFile(const char* path, long long& ticks) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        printf("Cannot open replay file: %s\n", path);
+        return false;
+    }
+    RockUpReplayHeader h;
+    if (fread(&h, sizeof(h), 1, f) != 1 || memcmp(h.magic, "RKRP", 4) != 0 || h.version < 1 || h.version > REPLAY_VERSION) {
+        printf("Invalid replay file: %s\n", path);
+        fclose(f);
+        return false;
+    }
+    static bool warned = false; // --bench-sim --session   ݺ  - ˸  
+    if (h.version >= 2) {
+        //     -  --map-set ٸ ˸
+        MapConfig recorded;
+        if (h.configBytes != sizeof(MapConfig) || fread(&recorded, sizeof(MapConfig), 1, f) != 1) {
+            printf("Invalid replay file (map config): %s\n", path);
+            fclose(f);
+            return false;
         }
-        if (currentState == PLAYING || currentState == CLEAR) {
-            drawList(mapShapes, false);
+        if (memcmp(&recorded, &mapConfig, sizeof(MapConfig)) != 0 && !warned) {
+            printf("Replay map config differs from command line, using the recorded one\n");
+            warned = true;
         }
-        };
+        mapConfig = recorded;
+    }
+    else if (!warned) {
+        printf("Warning: version 1 replay has no map config, assuming the current one\n");
+        warned = true;
+    }
 
-    // -------------------------------------------------------
-    // [STEP 1]  ȭ
-    // -------------------------------------------------------
-    glViewport(0, 0, g_width, g_height);
-    if (currentState == CLEAR) glClearColor(1.0f, 0.84f, 0.0f, 1.0f);
-    else glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    mapSeed = h.seed;
+    srand(mapSeed);
 
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    glUseProgram(shaderProgramID);
-    glEnable(GL_DEPTH_TEST);
+    ticks = 0;
+    int keys, flags;
+    while ((keys = fgetc(f)) != EOF && (flags = fgetc(f)) != EOF) {
+        UnpackMoveKeys((unsigned char)keys);
+        if (flags & INPUT_CAMERA) {
+            if (fread(&cameraYaw, sizeof(float), 1, f) != 1 || fread(&cameraPitch, sizeof(float), 1, f) != 1) break;
+        }
+        pendingEvents = (unsigned char)(flags & ~INPUT_CAMERA);
+        SimulationTick();
+        ticks++;
+    }
+    fclose(f);
+    return true;
+}
 
-    glm::mat4 mainView = glm::lookAt(cameraPos, cameraTarget, cameraUp);
-    glm::mat4 mainProj;
-    if (isPerspective) mainProj = glm::perspective(glm::radians(60.0f), (float)g_width / g_height, 0.1f, 1000.0f);
-    else { float s = 40.0f; float a = (float)g_width / g_height; mainProj = glm::ortho(-s * a, s * a, -s, s, 0.1f, 1000.0f); }
+// ùķ̼Ǹ غ (GL  浹ü/  )
+void InitHeadlessSimulation() {
+    GenerateLobby();
+    playerShape = ShapeSave(shapes, '1', 1.0f, 0.2f, 0.2f, rock.radius, rock.radius, rock.radius);
+}
 
-    RenderPass(mainView, mainProj, false);
+int RunReplay(const char* path) {
+    InitHeadlessSimulation();
 
-    // -------------------------------------------------------
-    // [STEP 2] ̴ϸ (ȸ )
-    // -------------------------------------------------------
-    if (currentState == PLAYING || currentState == CLEAR) {
+    long long ticks = 0;
+    FrameClock::time_point t0 = FrameClock::now();
+    if (!ReplayInputFile(path, ticks)) return 1;
+    double ms = std::chrono::duration<double, std::milli>(FrameClock::now() - t0).count();
 
-        int mapW = g_width / 5;
-        int mapH = g_height / 2.5;
-        int mapX = g_width - mapW - 20;
-        int mapY = g_height - mapH - 20;
+    const char* stateNames[] = { "LOBBY", "FALLING", "PLAYING", "CLEAR" };
+    printf("Replay: %lld ticks in %.1f ms (%.1f us/tick)\n", ticks, ms, ticks ? ms * 1000.0 / ticks : 0.0);
+    printf("Final: state %s, pos (%.4f, %.4f, %.4f), time %.2f, hash %08x\n",
+        stateNames[currentState], rock.position.x, rock.position.y, rock.position.z, gameTime, HashSimulationState());
+    return 0;
+}
 
-        glEnable(GL_SCISSOR_TEST);
-        glScissor(mapX, mapY, mapW, mapH);
-        glClearColor(0.9f, 0.9f, 0.9f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        glDisable(GL_SCISSOR_TEST);
+// --- ùķ̼ ġũ (--bench-sim) ---
+// â/GL  ܰ躰 : CheckCollision, UpdatePhysics(Ÿ ũ⺰), GenerateMap,  ׼̼,  
+// ־  SIM_BENCH_REPS ݺ, ݺ  ð /ǥ/95% ŷڱ 
+//   RockUp --bench-sim [--session run.rkr] [--out sim.json]
+// [߰] ROCKUP_COUNT_ALLOCS ϸ  Ҵ   ( PLAYING ƽ - 0̾ ,   /   )
+//  operator new ٲٹǷ ġũ 忡  - Ϲ  Ҵ ״
+const int SIM_BENCH_REPS = 30;
+const int SUBMIT_BENCH_OBJECTS = 100000; // [߰]      
+const double SIM_BENCH_WARMUP_SEC = 0.2;
+
+struct SimBenchResult {
+    std::string name;
+    long long itersPerRep = 0;
+    double meanNs = 0, stddevNs = 0, ci95Ns = 0, minNs = 0, medianNs = 0; // 1ȸ ns
+};
 
-        glViewport(mapX, mapY, mapW, mapH);
-        glDisable(GL_CULL_FACE);
+volatile float simBenchSink = 0.0f; // ȭ    ʰ
 
-        // [ٽ ] ī޶ ġ ÷̾ ȸ(cameraYaw) 缭 
-        float dist = 800.0f; // Ÿ ߽ɿ  Ÿ
-        float rad = glm::radians(cameraYaw); //  ī޶  ()
+#ifdef ROCKUP_COUNT_ALLOCS
+// [߰]  Ҵ  - heapAllocCounting     operator new ȣ 
+std::atomic<bool> heapAllocCounting{ false };
+std::atomic<long long> heapAllocCount{ 0 };
 
-        // cos, sin ̿  ī޶ ġ 
-        // (cameraYaw  -90 ϹǷ ǥ迡 缭 sin/cos )
-        //  ī޶ İ ϰ 󰡵, ̴ ߾(250) 
-        float camX = cos(rad) * dist;
-        float camZ = sin(rad) * dist;
+void* operator new(size_t size) {
+    if (heapAllocCounting.load(std::memory_order_relaxed)) heapAllocCount.fetch_add(1, std::memory_order_relaxed);
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// body     Ҵ 
+template <typename Body>
+long long CountHeapAllocs(Body body) {
+    heapAllocCount = 0;
+    heapAllocCounting = true;
+    body();
+    heapAllocCounting = false;
+    return heapAllocCount;
+}
+#endif
 
-        glm::vec3 miniCamPos(camX, 250.0f, camZ);
-        glm::vec3 miniCamTarget(0.0f, 250.0f, 0.0f); // Ÿ 㸮 ٶ
-        glm::mat4 miniView = glm::lookAt(miniCamPos, miniCamTarget, glm::vec3(0, 1, 0));
+//  95% t  Ӱ谪 ( df)
+double StudentT95(int df) {
+    static const double table[] = { 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+    if (df < 1) return 0.0;
+    return (df <= 30) ? table[df - 1] : 1.96;
+}
 
-        //  ü ̸ Ŀϴ 
-        // Y ߽ 250̹Ƿ, Ʒ 300  0~550 Ŀ 
-        glm::mat4 miniProj = glm::ortho(-70.0f, 70.0f, -300.0f, 300.0f, 0.1f, 2000.0f);
+// body(i) iters ȣϴ    ݺ , setup ݺ  ۿ ȣ
+template <typename Setup, typename Body>
+SimBenchResult MeasureSim(const std::string& name, long long iters, Setup setup, Body body) {
+    // ־
+    FrameClock::time_point warmEnd = FrameClock::now() + std::chrono::duration_cast<FrameClock::duration>(std::chrono::duration<double>(SIM_BENCH_WARMUP_SEC));
+    do {
+        setup();
+        for (long long i = 0; i < iters; ++i) body(i);
+    } while (FrameClock::now() < warmEnd);
+
+    std::vector<double> perIter;
+    for (int r = 0; r < SIM_BENCH_REPS; ++r) {
+        setup();
+        FrameClock::time_point t0 = FrameClock::now();
+        for (long long i = 0; i < iters; ++i) body(i);
+        double ns = std::chrono::duration<double, std::nano>(FrameClock::now() - t0).count();
+        perIter.push_back(ns / iters);
+    }
 
-        RenderPass(miniView, miniProj, true);
+    SimBenchResult res;
+    res.name = name;
+    res.itersPerRep = iters;
+    for (double v : perIter) res.meanNs += v;
+    res.meanNs /= perIter.size();
+    double var = 0.0;
+    for (double v : perIter) var += (v - res.meanNs) * (v - res.meanNs);
+    res.stddevNs = sqrt(var / (perIter.size() - 1));
+    res.ci95Ns = StudentT95((int)perIter.size() - 1) * res.stddevNs / sqrt((double)perIter.size());
+    std::sort(perIter.begin(), perIter.end());
+    res.minNs = perIter.front();
+    res.medianNs = perIter[perIter.size() / 2];
+    return res;
+}
 
-        glEnable(GL_CULL_FACE);
+//   ⺻ Է (   ) -  κ Ż  Ÿ ̵/
+void ScriptedSessionTick(long long t) {
+    if (t == 60) pendingEvents |= INPUT_JUMP;
+    keyState['w'] = t > 400 && (t / 90) % 3 != 2;
+    keyState['d'] = t > 400 && (t / 90) % 3 == 1;
+    if (t > 400 && t % 50 == 0) pendingEvents |= INPUT_JUMP;
+    if (t % 7 == 0) cameraYaw += ((t / 7) % 5) - 2.0f;
+    SimulationTick();
+}
+
+int RunSimBenchmark(int argc, char** argv) {
+    const char* outPath = NULL;
+    const char* sessionPath = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) outPath = argv[++i];
+        else if (strcmp(argv[i], "--session") == 0 && i + 1 < argc) sessionPath = argv[++i];
     }
 
-    glUseProgram(0);
+    InitHeadlessSimulation();
+    std::vector<SimBenchResult> results;
+
+    // 1. CheckCollision 1ȸ (/ )
+    results.push_back(MeasureSim("CheckCollision", 1000000, [] {}, [](long long i) {
+        glm::vec3 p((float)(i % 17) - 8.0f, (float)(i % 5), (float)(i % 11) - 5.0f);
+        simBenchSink = simBenchSink + (CheckCollision(p, 1.2f, glm::vec3(0.0f), glm::vec3(4.0f, 0.5f, 4.0f)) ? 1.0f : 0.0f);
+    }));
+
+    // 2. GenerateMap  (¦   )
+    int layers = (mapConfig.layers + mapConfig.layerStep - 1) / mapConfig.layerStep;
+    SimBenchResult gen = MeasureSim("GenerateMap", 1, [] {
+        ReleaseRunData(); srand(mapSeed);
+    }, [](long long) { GenerateMap(); });
+    gen.name = "GenerateMap/layer";
+    gen.meanNs /= layers; gen.stddevNs /= layers; gen.ci95Ns /= layers; gen.minNs /= layers; gen.medianNs /= layers;
+    results.push_back(gen);
+
+    // [߰] 2-1. GenerateMap ۾  Ȯ强 (0 ~ 16) -     
+    //     (BuildSceneGeometrySet)  ٲ  ϹǷ Բ 
+    // []  ۾  0 (θ  ȥ - 1 θ  + ۾  ϳ)
+    double genSerialNs = 0.0;
+    for (int workers : { 0, 1, 2, 4, 8, 16 }) {
+        StartJobSystem(workers);
+        char name[64];
+        if (workers == 0) sprintf(name, "GenerateMap+geometry[serial]");
+        else sprintf(name, "GenerateMap+geometry[%d workers]", workers);
+        results.push_back(MeasureSim(name, 1, [] {
+            ReleaseRunData(); srand(mapSeed);
+        }, [](long long) {
+            GenerateMap();
+            BuildSceneGeometrySet(0);
+        }));
+        if (workers == 0) genSerialNs = results.back().meanNs;
+        fprintf(stderr, "%-32s speedup x%.2f\n", name, genSerialNs / results.back().meanNs);
+    }
+    StartJobSystem(DefaultJobWorkers());
+
+    // 3.  ׼̼ (ShapeSave('1'),   )
+    ShapeList scratch;
+    results.push_back(MeasureSim("ShapeSave('1') sphere", 20, [&] { scratch.clear(); }, [&](long long) {
+        ShapeSave(scratch, '1', 1.0f, 0.2f, 0.2f, rock.radius, rock.radius, rock.radius);
+    }));
+
+    // 4. UpdatePhysics ƽ - GenerateMap   ׾ Ÿ(浹ü ) Ű
+    for (int copies : { 1, 4, 16, 64 }) {
+        ResetGame();
+        for (int c = 0; c < copies; ++c) GenerateMap();
+        currentState = PLAYING;
+        Player start = rock;
+        start.position = glm::vec3(0.0f, 200.0f, 0.0f);
+        start.velocity = glm::vec3(0.05f, 0.0f, 0.1f);
+
+        char name[64];
+        sprintf(name, "UpdatePhysics[%d blocks]", (int)mapBlocks.size());
+        results.push_back(MeasureSim(name, 200, [&] { rock = start; currentState = PLAYING; }, [](long long) {
+            UpdatePhysics();
+        }));
+    }
 
-    if (currentState == PLAYING || currentState == CLEAR) {
-        sprintf(timeBuffer, "TIME: %.2f", gameTime);
-        // scale 0.3f  ->  ū ũ
-        RenderText(20, g_height - 80, timeBuffer, 0.7f, 0.0f, 0.0f, 0.7f);
+    // 5. ü   (  Ǵ  Է 6000ƽ)
+    if (sessionPath) {
+        long long ticks = 0;
+        results.push_back(MeasureSim("Replay session/tick", 1, [] { ResetGame(); simTick = 0; }, [&](long long) {
+            ReplayInputFile(sessionPath, ticks);
+        }));
+        results.back().meanNs /= std::max(1LL, ticks); results.back().stddevNs /= std::max(1LL, ticks);
+        results.back().ci95Ns /= std::max(1LL, ticks); results.back().minNs /= std::max(1LL, ticks); results.back().medianNs /= std::max(1LL, ticks);
+    }
+    else {
+        results.push_back(MeasureSim("Scripted session/tick", 6000, [] {
+            ResetGame(); simTick = 0; cameraYaw = 270.0f;
+        }, [](long long t) { ScriptedSessionTick(t); }));
     }
 
-    if (currentState == CLEAR) {
-        // scale 0.5f  -> ſ ū ũ
-        RenderText(g_width / 2 - 200, g_height / 2, "GAME CLEAR!", 1.0f, 0.0f, 0.0f, 0.5f);
-        RenderText(g_width / 2 - 150, g_height / 2 - 100, timeBuffer, 1.0f, 0.0f, 0.0f, 0.4f);
+#ifdef ROCKUP_COUNT_ALLOCS
+    // [߰]      - ۰   PLAYING ƽ Ҵ   (  /  ƽ )
+    long long playingTicks = 0, playingAllocs = 0;
+    ResetGame(); simTick = 0; cameraYaw = 270.0f;
+    for (long long t = 0; t < 6000; ++t) {
+        bool playing = currentState == PLAYING;
+        long long allocs = CountHeapAllocs([t] { ScriptedSessionTick(t); });
+        if (playing && currentState == PLAYING) { playingTicks++; playingAllocs += allocs; }
     }
-    glBindVertexArray(0);
-    glutSwapBuffers();
-}
 
-void TimerFunction(int value) {
-    UpdatePhysics();
-    glutPostRedisplay();
-    glutTimerFunc(16, TimerFunction, 0);
+    // [߰]  ϳ  (޽ ϱ  ) / ٽ  + ޽ 
+    ReleaseRunData(); GenerateMap(); BuildSceneGeometrySet(0);
+    long long releaseAllocs = CountHeapAllocs([] { ReleaseRunData(); });
+    long long regenAllocs = CountHeapAllocs([] { GenerateMap(); BuildSceneGeometrySet(0); });
+    size_t regenShapes = mapShapes.size();
+#endif
+
+    // [߰] 6. Ӵ   -   10  CPU  (PrepareFrame) ڵ /  ɱ
+    //  ť ϳ  (޽ ڵ鸸 ), ֹ /   ̴ϸ ܿ ؽó õ ħ
+    {
+        ReleaseRunData();
+        mapShapes.Emplace(MakeShape('c', 0.5f, 0.6f, 0.5f, 2.0f, 0.5f, 2.0f));
+        std::vector<Shape*> cubeMesh(1, &mapShapes[0]);
+        CommitShapeMeshes(cubeMesh, true);
+        Shape cube = mapShapes[0];
+        mapShapes.clear();
+        mapShapes.reserve(SUBMIT_BENCH_OBJECTS);
+        for (int i = 0; i < SUBMIT_BENCH_OBJECTS; ++i) {
+            cube.x = (i % 100) * 5.0f - 250.0f;
+            cube.y = (i / 1000) * 3.0f;
+            cube.z = ((i / 100) % 10) * 5.0f - 25.0f;
+            cube.isObstacle = (i % 10) == 0;
+            cube.isWall = (i % 7) == 0;
+            mapShapes.Emplace(cube);
+        }
+
+        RenderSnapshot snap;
+        snap.state = PLAYING;
+        snap.cameraPos = glm::vec3(0.0f, 150.0f, 300.0f);
+        snap.cameraTarget = glm::vec3(0.0f, 150.0f, 0.0f);
+        snap.cameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
+        snap.playerOrientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        snap.towerMid = 150.0f;
+        snap.mapHalfWidth = 300.0f;
+        snap.geometry = BuildSceneGeometrySet(0);
+
+        // GL  - ڵ ݸ ϰ   ۼ 
+        GLsizeiptr savedStride = objectRing.stride;
+        bool savedMultiDraw = sceneGeometry.multiDraw;
+        if (objectRing.stride == 0) objectRing.stride = sizeof(ObjectRecord);
+        sceneGeometry.multiDraw = true;
+        PreparedFrame frame;
+        char name[64];
+        sprintf(name, "PrepareFrame[%dk objects]", SUBMIT_BENCH_OBJECTS / 1000);
+        results.push_back(MeasureSim(name, 1, [] {}, [&](long long) { PrepareFrame(snap, frame); }));
+        simBenchSink = simBenchSink + (float)frame.commands.size();
+        objectRing.stride = savedStride;
+        sceneGeometry.multiDraw = savedMultiDraw;
+        snap.geometry.reset();
+        ReleaseRunData();
+    }
+
+    //  д  stderr (stdout JSON)
+    for (const auto& r : results) {
+        fprintf(stderr, "%-32s %12.1f ns +- %.1f (95%% CI)\n", r.name.c_str(), r.meanNs, r.ci95Ns);
+    }
+#ifdef ROCKUP_COUNT_ALLOCS
+    fprintf(stderr, "Heap allocations in PLAYING ticks: %lld over %lld ticks\n", playingAllocs, playingTicks);
+    fprintf(stderr, "Heap allocations: ReleaseRunData %lld, GenerateMap + mesh commit %lld (%d shapes)\n",
+        releaseAllocs, regenAllocs, (int)regenShapes);
+#else
+    fprintf(stderr, "Heap allocation counts: build with ROCKUP_COUNT_ALLOCS\n");
+#endif
+
+    FILE* out = outPath ? fopen(outPath, "w") : stdout;
+    if (!out) out = stdout;
+    fprintf(out, "{\n  \"reps\": %d,\n", SIM_BENCH_REPS);
+#ifdef ROCKUP_COUNT_ALLOCS
+    fprintf(out, "  \"playing_ticks\": %lld,\n  \"playing_heap_allocs\": %lld,\n  \"release_heap_allocs\": %lld,\n  \"regen_heap_allocs\": %lld,\n",
+        playingTicks, playingAllocs, releaseAllocs, regenAllocs);
+#endif
+    fprintf(out, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const SimBenchResult& r = results[i];
+        fprintf(out, "    { \"name\": \"%s\", \"iters_per_rep\": %lld, \"mean_ns\": %.2f, \"stddev_ns\": %.2f, \"ci95_ns\": %.2f, \"min_ns\": %.2f, \"median_ns\": %.2f }%s\n",
+            r.name.c_str(), r.itersPerRep, r.meanNs, r.stddevNs, r.ci95Ns, r.minNs, r.medianNs, (i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    if (out != stdout) fclose(out);
+    return 0;
 }
 
 GLvoid Reshape(int w, int h) { 
-    g_width = w; g_height = h; 
+    SetViewSize(w, h); // []  غ 嵵 
     glViewport(0, 0, w, h); 
 }
 char* filetobuf(const char* file) {
@@ -950,45 +4478,282 @@ char* filetobuf(const char* file) {
     fseek(f, 0, SEEK_END); long len = ftell(f); char* buf = (char*)malloc(len + 1);
     fseek(f, 0, SEEK_SET); fread(buf, len, 1, f); fclose(f); buf[len] = 0; return buf;
 }
-void make_vertexShaders() {
-    GLchar* src = filetobuf("vertex.glsl"); vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &src, NULL); glCompileShader(vertexShader);
+
+// --- ̴  / α׷ ̳ʸ ĳ ---
+// ũ α׷ glGetProgramBinary ≮>.rprog ,   glProgramBinary ٷ 
+// Ű = ҽ ؽ + ̹ (GL_VENDOR / GL_RENDERER / GL_VERSION) - ϳ ٲ ٽ 
+// 簡 ص (̹ Ʈ ) ü Ϸ ,  / ũ  α 
+const uint32_t PROGRAM_CACHE_MAGIC = 0x47525052; // 'RPRG'
+const uint32_t PROGRAM_CACHE_VERSION = 1;
+
+struct ProgramCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t format;  // glGetProgramBinary  ̳ʸ 
+    uint32_t length;
+};
+
+struct ShaderStage {
+    GLenum type;
+    std::string source;
+};
+
+std::string ReadShaderFile(const char* file) {
+    char* buf = filetobuf(file);
+    if (!buf) {
+        printf("[Shader] Cannot open file: %s\n", file);
+        return "";
+    }
+    std::string src(buf);
+    free(buf);
+    return src;
+}
+
+// [] ù (#version)  Ʈ ´ Ӹ ٲ (̴ )
+std::string SceneShaderSource(const char* file, int features) {
+    std::string src = ReadShaderFile(file);
+    size_t eol = src.find('\n');
+    std::string header = (features & SHADER_MULTIDRAW) ? "#version 430 core\n#define OBJECT_SSBO\n" : "#version 330 core\n";
+    if (features & SHADER_TEXTURED) header += "#define TEXTURED\n#define MAX_TEXTURE_LAYERS " + std::to_string(MAX_TEXTURE_LAYERS) + "\n";
+    if (features & SHADER_VERTEX_COLOR) header += "#define VERTEX_COLOR\n";
+    return header + (eol == std::string::npos ? src : src.substr(eol + 1));
 }
-void make_fragmentShaders() {
-    GLchar* src = filetobuf("fragment.glsl"); fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &src, NULL); glCompileShader(fragmentShader);
+
+bool CheckShaderCompile(GLuint shader, const char* name) {
+    GLint ok = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (ok) return true;
+    char log[2048] = { 0 };
+    glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+    printf("[Shader] %s compile failed:\n%s\n", name, log);
+    return false;
 }
-GLuint make_shaderProgram() {
-    GLuint id = glCreateProgram(); glAttachShader(id, vertexShader); glAttachShader(id, fragmentShader);
-    glLinkProgram(id); glDeleteShader(vertexShader); glDeleteShader(fragmentShader); return id;
+
+bool CheckProgramLink(GLuint program, const char* name) {
+    GLint ok = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (ok) return true;
+    char log[2048] = { 0 };
+    glGetProgramInfoLog(program, sizeof(log), NULL, log);
+    printf("[Shader] %s link failed:\n%s\n", name, log);
+    return false;
 }
-void setupShapeBuffers(Shape& s, const std::vector<float>& v, const std::vector<float>& c, const std::vector<float>& n) {
-    glGenVertexArrays(1, &s.VAO);
-    glGenBuffers(1, &s.VBO); glGenBuffers(1, &s.CBO); glGenBuffers(1, &s.NBO);
-    glGenBuffers(1, &s.TBO); // [߰]
 
-    glBindVertexArray(s.VAO);
+// FNV-1a 64Ʈ - ҽ ̹ ڿ
+uint64_t HashProgramKey(const std::vector<ShaderStage>& stages) {
+    uint64_t h = 1469598103934665603ULL;
+    auto mix = [&](const void* data, size_t len) {
+        const unsigned char* p = (const unsigned char*)data;
+        for (size_t i = 0; i < len; ++i) { h ^= p[i]; h *= 1099511628211ULL; }
+    };
+    for (const ShaderStage& st : stages) {
+        mix(&st.type, sizeof(st.type));
+        mix(st.source.data(), st.source.size());
+    }
+    for (GLenum e : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+        const char* str = (const char*)glGetString(e);
+        if (str) mix(str, strlen(str));
+    }
+    return h;
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, s.VBO); glBufferData(GL_ARRAY_BUFFER, v.size() * 4, v.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0); glEnableVertexAttribArray(0);
+bool ProgramBinarySupported() {
+    static GLint formats = -1;
+    if (formats < 0) {
+        formats = 0;
+        if (GLEW_ARB_get_program_binary || GLEW_VERSION_4_1) glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    }
+    return formats > 0;
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, s.NBO); glBufferData(GL_ARRAY_BUFFER, n.size() * 4, n.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, 0); glEnableVertexAttribArray(1);
+// ĳð  ũ α׷, ƴϸ 0
+GLuint LoadProgramBinary(const std::string& path, uint64_t key) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return 0;
+    ProgramCacheHeader h;
+    std::vector<unsigned char> data;
+    bool ok = fread(&h, sizeof(h), 1, f) == 1 && h.magic == PROGRAM_CACHE_MAGIC &&
+        h.version == PROGRAM_CACHE_VERSION && h.key == key && h.length > 0;
+    if (ok) {
+        data.resize(h.length);
+        ok = fread(data.data(), 1, h.length, f) == h.length;
+    }
+    fclose(f);
+    if (!ok) return 0;
+
+    GLuint id = glCreateProgram();
+    glProgramBinary(id, h.format, data.data(), h.length);
+    GLint linked = 0;
+    glGetProgramiv(id, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        glDeleteProgram(id); // ̹ ź -> ٽ 
+        return 0;
+    }
+    return id;
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, s.CBO); glBufferData(GL_ARRAY_BUFFER, c.size() * 4, c.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, 0); glEnableVertexAttribArray(2);
+void SaveProgramBinary(GLuint program, const std::string& path, uint64_t key) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+    std::vector<unsigned char> data(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, NULL, &format, data.data());
+
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return;
+    ProgramCacheHeader h = { PROGRAM_CACHE_MAGIC, PROGRAM_CACHE_VERSION, key, format, (uint32_t)length };
+    fwrite(&h, sizeof(h), 1, f);
+    fwrite(data.data(), 1, length, f);
+    fclose(f);
+}
 
-    // [߰] ؽó ǥ  ε
-    if (!s.uvs.empty()) {
-        glBindBuffer(GL_ARRAY_BUFFER, s.TBO);
-        glBufferData(GL_ARRAY_BUFFER, s.uvs.size() * sizeof(float), s.uvs.data(), GL_STATIC_DRAW);
-        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 0, 0); // location 3
-        glEnableVertexAttribArray(3);
+// [] 񵿱  -  / ũ ⸸ ϰ ´ PollProgramBuilds Ȯ
+// GL_KHR_parallel_shader_compile̸ GL_COMPLETION_STATUS_KHR   ( ),
+//  ù Ȯο ̹  ĥ  ٸ (â ̹  )
+struct ProgramBuild {
+    std::string name;
+    std::string cachePath;
+    uint64_t key = 0;
+    GLuint program = 0;
+    std::vector<GLuint> shaders;
+    ProgramReadyFn onReady;
+};
+std::vector<ProgramBuild> pendingPrograms;
+int pendingProgramsSubmitted = 0;
+
+// ĳÿ Ǹ ٷ onReady, ƴϸ  Ͽ ߰
+GLuint SubmitProgram(const char* name, const std::vector<ShaderStage>& stages, ProgramReadyFn onReady) {
+    FrameClock::time_point t0 = FrameClock::now();
+    bool useCache = ProgramBinarySupported();
+    uint64_t key = useCache ? HashProgramKey(stages) : 0;
+    std::string path = std::string(name) + ".rprog";
+
+    if (useCache) {
+        GLuint cached = LoadProgramBinary(path, key);
+        if (cached) {
+            printf("[Shader] %s: loaded from cache in %.2f ms\n", name, std::chrono::duration<double, std::milli>(FrameClock::now() - t0).count());
+            onReady(cached, true);
+            return cached;
+        }
     }
 
-    glBindVertexArray(0);
+    ProgramBuild b;
+    b.name = name;
+    b.cachePath = useCache ? path : "";
+    b.key = key;
+    b.onReady = onReady;
+    b.program = glCreateProgram();
+    for (const ShaderStage& st : stages) {
+        GLuint sh = glCreateShader(st.type);
+        const GLchar* src = st.source.c_str();
+        glShaderSource(sh, 1, &src, NULL); glCompileShader(sh);
+        glAttachShader(b.program, sh);
+        b.shaders.push_back(sh);
+    }
+    if (useCache) glProgramParameteri(b.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(b.program);
+    pendingPrograms.push_back(b);
+    pendingProgramsSubmitted++;
+    return b.program;
+}
+
+// ũ  α׷  -  α, ĳ , onReady
+void FinishProgramBuild(ProgramBuild& b) {
+    for (GLuint sh : b.shaders) {
+        CheckShaderCompile(sh, b.name.c_str());
+        glDetachShader(b.program, sh);
+        glDeleteShader(sh);
+    }
+    bool ok = CheckProgramLink(b.program, b.name.c_str());
+    if (ok && !b.cachePath.empty()) SaveProgramBinary(b.program, b.cachePath, b.key);
+    b.onReady(b.program, ok);
+}
+
+// [߰] ׸  / HUDó ü   α׷ ϸ ε ȭ鿡 ӹ ʰ 
+// ( / ũ α״ FinishProgramBuild ̹ )
+void FailRequiredProgram(const char* name) {
+    printf("[Shader] required program %s failed to build, exiting\n", name);
+    fflush(stdout);
+    exit(1);
+}
+
+void PollProgramBuilds() {
+    if (pendingPrograms.empty()) return;
+    for (size_t i = 0; i < pendingPrograms.size();) {
+        GLint done = 1;
+        if (parallelShaderCompile) glGetProgramiv(pendingPrograms[i].program, GL_COMPLETION_STATUS_KHR, &done);
+        if (!done) { ++i; continue; }
+        ProgramBuild b = pendingPrograms[i];
+        pendingPrograms.erase(pendingPrograms.begin() + i);
+        FinishProgramBuild(b);
+    }
+    if (pendingPrograms.empty()) {
+        printf("[Shader] %d programs built (%d ms after start, parallel compile %s)\n",
+            pendingProgramsSubmitted, GetElapsedMs(), parallelShaderCompile ? "on" : "unsupported");
+    }
+}
+
+//     (--benchó   غ   )
+void WaitProgramBuilds() {
+    while (!pendingPrograms.empty()) {
+        PollProgramBuilds();
+        if (!pendingPrograms.empty()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+GLuint make_shaderProgram(int features, ProgramReadyFn onReady) {
+    char name[32];
+    sprintf(name, "scene_%d", features);
+    return SubmitProgram(name, {
+        { GL_VERTEX_SHADER, SceneShaderSource("vertex.glsl", features) },
+        { GL_FRAGMENT_SHADER, SceneShaderSource("fragment.glsl", features) } }, onReady);
+}
+GLuint make_cullProgram(ProgramReadyFn onReady) {
+    return SubmitProgram("cull", { { GL_COMPUTE_SHADER, ReadShaderFile("cull_compute.glsl") } }, onReady);
 }
-Shape* ShapeSave(std::vector<Shape>& list, char key, float r, float g, float b, float sx, float sy, float sz) {
+GLuint make_textShaderProgram(ProgramReadyFn onReady) {
+    return SubmitProgram("text", {
+        { GL_VERTEX_SHADER, ReadShaderFile("text_vertex.glsl") },
+        { GL_FRAGMENT_SHADER, ReadShaderFile("text_fragment.glsl") } }, onReady);
+}
+// [߰]    s  迭 ڿ  (sec: 浵 , st:  )
+void AppendSphere(Shape& s, float rad, int sec, int st) {
+    std::vector<float> tv, tn, tuv; // tuv(ؽóǥ) ߰
+
+    for (int i = 0; i <= st; ++i) {
+        float ang = M_PI / 2 - i * M_PI / st, xy = rad * cosf(ang), z = rad * sinf(ang);
+        for (int j = 0; j <= sec; ++j) {
+            float sa = j * 2 * M_PI / sec, x = xy * cosf(sa), y = xy * sinf(sa);
+            tv.push_back(x); tv.push_back(y); tv.push_back(z);
+            tn.push_back(x / rad); tn.push_back(y / rad); tn.push_back(z / rad);
+
+            // [߰] UV ǥ 
+            tuv.push_back((float)j / sec);       // u
+            tuv.push_back((float)i / st);        // v
+        }
+    }
+    for (int i = 0; i < st; ++i) {
+        int k1 = i * (sec + 1), k2 = k1 + sec + 1;
+        for (int j = 0; j < sec; ++j, ++k1, ++k2) {
+            if (i != 0) {
+                s.vertices.insert(s.vertices.end(), { tv[k1 * 3],tv[k1 * 3 + 1],tv[k1 * 3 + 2], tv[k2 * 3],tv[k2 * 3 + 1],tv[k2 * 3 + 2], tv[(k1 + 1) * 3],tv[(k1 + 1) * 3 + 1],tv[(k1 + 1) * 3 + 2] });
+                s.normals.insert(s.normals.end(), { tn[k1 * 3],tn[k1 * 3 + 1],tn[k1 * 3 + 2], tn[k2 * 3],tn[k2 * 3 + 1],tn[k2 * 3 + 2], tn[(k1 + 1) * 3],tn[(k1 + 1) * 3 + 1],tn[(k1 + 1) * 3 + 2] });
+                // [߰] UV insert
+                s.uvs.insert(s.uvs.end(), { tuv[k1 * 2],tuv[k1 * 2 + 1], tuv[k2 * 2],tuv[k2 * 2 + 1], tuv[(k1 + 1) * 2],tuv[(k1 + 1) * 2 + 1] });
+            }
+            if (i != st - 1) {
+                s.vertices.insert(s.vertices.end(), { tv[(k1 + 1) * 3],tv[(k1 + 1) * 3 + 1],tv[(k1 + 1) * 3 + 2], tv[k2 * 3],tv[k2 * 3 + 1],tv[k2 * 3 + 2], tv[(k2 + 1) * 3],tv[(k2 + 1) * 3 + 1],tv[(k2 + 1) * 3 + 2] });
+                s.normals.insert(s.normals.end(), { tn[(k1 + 1) * 3],tn[(k1 + 1) * 3 + 1],tn[(k1 + 1) * 3 + 2], tn[k2 * 3],tn[k2 * 3 + 1],tn[k2 * 3 + 2], tn[(k2 + 1) * 3],tn[(k2 + 1) * 3 + 1],tn[(k2 + 1) * 3 + 2] });
+                // [߰] UV insert
+                s.uvs.insert(s.uvs.end(), { tuv[(k1 + 1) * 2],tuv[(k1 + 1) * 2 + 1], tuv[k2 * 2],tuv[k2 * 2 + 1], tuv[(k2 + 1) * 2],tuv[(k2 + 1) * 2 + 1] });
+            }
+        }
+    }
+}
+// []  ϳ  -  ¸ ǵ帮  (۾ 忡 ȣ )
+Shape MakeShape(char key, float r, float g, float b, float sx, float sy, float sz) {
     Shape s; s.color[0] = r; s.color[1] = g; s.color[2] = b; s.shapeType = key; s.primitiveType = GL_TRIANGLES;
 
     if (key == 'c') {
@@ -1000,43 +4765,27 @@ Shape* ShapeSave(std::vector<Shape>& list, char key, float r, float g, float b,
         s.vertexCount = 36;
     }
     else if (key == '1') {
-        int sec = 30, st = 30; float rad = sx;
-        std::vector<float> tv, tn, tuv; // tuv(ؽóǥ) ߰
-
-        for (int i = 0; i <= st; ++i) {
-            float ang = M_PI / 2 - i * M_PI / st, xy = rad * cosf(ang), z = rad * sinf(ang);
-            for (int j = 0; j <= sec; ++j) {
-                float sa = j * 2 * M_PI / sec, x = xy * cosf(sa), y = xy * sinf(sa);
-                tv.push_back(x); tv.push_back(y); tv.push_back(z);
-                tn.push_back(x / rad); tn.push_back(y / rad); tn.push_back(z / rad);
-
-                // [߰] UV ǥ 
-                tuv.push_back((float)j / sec);       // u
-                tuv.push_back((float)i / st);        // v
-            }
-        }
-        for (int i = 0; i < st; ++i) {
-            int k1 = i * (sec + 1), k2 = k1 + sec + 1;
-            for (int j = 0; j < sec; ++j, ++k1, ++k2) {
-                if (i != 0) {
-                    s.vertices.insert(s.vertices.end(), { tv[k1 * 3],tv[k1 * 3 + 1],tv[k1 * 3 + 2], tv[k2 * 3],tv[k2 * 3 + 1],tv[k2 * 3 + 2], tv[(k1 + 1) * 3],tv[(k1 + 1) * 3 + 1],tv[(k1 + 1) * 3 + 2] });
-                    s.normals.insert(s.normals.end(), { tn[k1 * 3],tn[k1 * 3 + 1],tn[k1 * 3 + 2], tn[k2 * 3],tn[k2 * 3 + 1],tn[k2 * 3 + 2], tn[(k1 + 1) * 3],tn[(k1 + 1) * 3 + 1],tn[(k1 + 1) * 3 + 2] });
-                    // [߰] UV insert
-                    s.uvs.insert(s.uvs.end(), { tuv[k1 * 2],tuv[k1 * 2 + 1], tuv[k2 * 2],tuv[k2 * 2 + 1], tuv[(k1 + 1) * 2],tuv[(k1 + 1) * 2 + 1] });
-                }
-                if (i != st - 1) {
-                    s.vertices.insert(s.vertices.end(), { tv[(k1 + 1) * 3],tv[(k1 + 1) * 3 + 1],tv[(k1 + 1) * 3 + 2], tv[k2 * 3],tv[k2 * 3 + 1],tv[k2 * 3 + 2], tv[(k2 + 1) * 3],tv[(k2 + 1) * 3 + 1],tv[(k2 + 1) * 3 + 2] });
-                    s.normals.insert(s.normals.end(), { tn[(k1 + 1) * 3],tn[(k1 + 1) * 3 + 1],tn[(k1 + 1) * 3 + 2], tn[k2 * 3],tn[k2 * 3 + 1],tn[k2 * 3 + 2], tn[(k2 + 1) * 3],tn[(k2 + 1) * 3 + 1],tn[(k2 + 1) * 3 + 2] });
-                    // [߰] UV insert
-                    s.uvs.insert(s.uvs.end(), { tuv[(k1 + 1) * 2],tuv[(k1 + 1) * 2 + 1], tuv[k2 * 2],tuv[k2 * 2 + 1], tuv[(k2 + 1) * 2],tuv[(k2 + 1) * 2 + 1] });
-                }
-            }
+        // []    ޸ LOD ܰ  ۿ ̾ 
+        for (int i = 0; i < SPHERE_LOD_COUNT; ++i) {
+            s.lodFirst[i] = s.vertices.size() / 3;
+            AppendSphere(s, sx, SPHERE_LOD_DIVISIONS[i], SPHERE_LOD_DIVISIONS[i]);
+            s.lodVertexCount[i] = s.vertices.size() / 3 - s.lodFirst[i];
         }
+        s.lodLevels = SPHERE_LOD_COUNT;
+        s.lodRadius = sx;
         s.vertexCount = s.vertices.size() / 3;
     }
+    s.colors.reserve((size_t)s.vertexCount * 3); // [߰]   Ҵ
     for (int i = 0; i < s.vertexCount; ++i) { s.colors.push_back(r); s.colors.push_back(g); s.colors.push_back(b); }
+    return s;
+}
+
+ShapeHandle ShapeSave(ShapeList& list, char key, float r, float g, float b, float sx, float sy, float sz) {
+    return ShapeSave(list, MakeShape(key, r, g, b, sx, sy, sz)); // []   ڵ ( Ŀ ȿ)
+}
 
-    // setup ȣ
-    setupShapeBuffers(s, s.vertices, s.colors, s.normals);
-    list.push_back(s); return &list.back();
+// [߰] ġ / ÷ױ ä  Ͽ 
+ShapeHandle ShapeSave(ShapeList& list, Shape&& shape) {
+    sceneShapesDirty = true; // [] GL     ۸ ٽ  ǥ
+    return list.Emplace(std::move(shape));
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#version 330 core
+
+in vec2 TexCoord;
+in vec3 textColor;
+
+out vec4 FragColor;
+
+uniform sampler2D glyphAtlas; // SDF Ʋ (0.5 =  )
+
+void main() {
+    float dist = texture(glyphAtlas, TexCoord).r;
+    float width = fwidth(dist);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, dist);
+    FragColor = vec4(textColor, alpha);
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#version 330 core
+
+layout(location = 0) in vec2 vPos;      // ȭ ȼ ǥ (ϴ )
+layout(location = 1) in vec2 vTexCoord; // ۸ Ʋ ǥ
+layout(location = 2) in vec3 vColor;
+
+out vec2 TexCoord;
+out vec3 textColor;
+
+uniform vec2 screenSize;
+
+void main() {
+    gl_Position = vec4(vPos / screenSize * 2.0 - 1.0, 0.0, 1.0);
+    TexCoord = vTexCoord;
+    textColor = vColor;
+}
\ No newline at end of file
@@ -4,20 +4,57 @@ layout(location = 0) in vec3 vPos;
 layout(location = 1) in vec3 vNormal;
 layout(location = 2) in vec3 vColor;
 layout(location = 3) in vec2 vTexCoord; // [߰] ؽó ǥ
+layout(location = 4) in float vLayer;   // [߰] ؽó 迭 ̾ ( )
 
 out vec3 FragPos;
 out vec3 Normal;
 out vec3 vertexColor;
 out vec2 TexCoord; // [߰] ׸Ʈ ̴ 
+out float Layer;   // [߰] ؽó 迭 ̾
+flat out vec3 ObjectColor; // [߰]   ׸Ʈ ѱ
 
-uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
+#ifdef TEXTURED
+uniform vec2 layerScale[MAX_TEXTURE_LAYERS]; // [߰] ̾ UV  (̾ ȿ  ϴ )
+#endif
+
+// []  ʹ   ڵ
+// objectFlags x: useVertexColor, y: useTexture (̴  ÿ), z: ؽó ̾ (-1̸  Ӽ vLayer )
+#ifdef OBJECT_SSBO
+// MultiDrawIndirect  (#version 430) -  baseInstance νϽ Ӽ  ڵ ȣ 
+struct ObjectRecord {
+    mat4 model;
+    vec4 objectColor;
+    ivec4 objectFlags;
+};
+layout(std430, binding = 1) readonly buffer ObjectBuffer {
+    ObjectRecord objects[];
+};
+layout(location = 5) in uint vDrawID;
+#else
+layout(std140) uniform ObjectData {
+    mat4 model;
+    vec4 objectColor;  // rgb
+    ivec4 objectFlags;
+};
+#endif
 
 void main() {
+#ifdef OBJECT_SSBO
+    mat4 model = objects[vDrawID].model;
+    vec4 objectColor = objects[vDrawID].objectColor;
+    ivec4 objectFlags = objects[vDrawID].objectFlags;
+#endif
     gl_Position = projection * view * model * vec4(vPos, 1.0);
     FragPos = vec3(model * vec4(vPos, 1.0));
     Normal = mat3(transpose(inverse(model))) * vNormal; // [] 븻  (ϸ  )
     vertexColor = vColor;
+    Layer = (objectFlags.z < 0) ? vLayer : float(objectFlags.z);
+#ifdef TEXTURED
+    TexCoord = vTexCoord * layerScale[int(Layer + 0.5)]; // []    
+#else
     TexCoord = vTexCoord; // [߰]
+#endif
+    ObjectColor = objectColor.rgb;
 }
\ No newline at end of file